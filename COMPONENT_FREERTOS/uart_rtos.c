@@ -0,0 +1,258 @@
+/******************************************************************************
+* File Name:   uart_rtos.c
+*
+* Description: This file contains the FreeRTOS binding of the UART FIFO driver.
+*              The FIFO interrupts wake the waiting task with a direct-to-task
+*              notification; no mutex or queue is used on the data path.
+*              Only built with COMPONENTS=FREERTOS.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#include "uart_rtos.h"
+#include "uart_fifo.h"
+
+/*******************************************************************************
+*  Global Variables
+*******************************************************************************/
+/* Tasks waiting for the write and the read to complete */
+static TaskHandle_t tx_task;
+static TaskHandle_t rx_task;
+
+/*******************************************************************************
+* Function Name: uart_rtos_tx_done
+********************************************************************************
+* Summary:
+* Write completion callback, notifies the writing task from the TX ISR.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void uart_rtos_tx_done(void)
+{
+    BaseType_t woken = pdFALSE;
+
+    if (tx_task != NULL)
+    {
+        xTaskNotifyFromISR(tx_task, UART_RTOS_NOTIFY_TX, eSetBits, &woken);
+    }
+    portYIELD_FROM_ISR(woken);
+}
+
+/*******************************************************************************
+* Function Name: uart_rtos_rx_done
+********************************************************************************
+* Summary:
+* Read completion callback, notifies the reading task from the RX ISR.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void uart_rtos_rx_done(void)
+{
+    BaseType_t woken = pdFALSE;
+
+    if (rx_task != NULL)
+    {
+        xTaskNotifyFromISR(rx_task, UART_RTOS_NOTIFY_RX, eSetBits, &woken);
+    }
+    portYIELD_FROM_ISR(woken);
+}
+
+/*******************************************************************************
+* Function Name: uart_rtos_wait
+********************************************************************************
+* Summary:
+* Blocks the calling task until the notification bit is set or the timeout
+* expires. Notifications with other bits do not end the wait.
+*
+* Parameters:
+*  bit:     Notification bit to wait for
+*  timeout: Timeout in ticks
+*
+* Return:
+*  bool: true if the bit was received
+*
+*******************************************************************************/
+static bool uart_rtos_wait(uint32_t bit, TickType_t timeout)
+{
+    TimeOut_t time_out;
+    uint32_t value = 0U;
+
+    vTaskSetTimeOutState(&time_out);
+
+    while ((value & bit) == 0U)
+    {
+        if (xTaskCheckForTimeOut(&time_out, &timeout) != pdFALSE)
+        {
+            return false;
+        }
+        (void)xTaskNotifyWait(0U, bit, &value, timeout);
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: uart_rtos_init
+********************************************************************************
+* Summary:
+* Registers the completion callbacks with the FIFO driver. Call after
+* uart_fifo_init(). The FIFO interrupt priorities must not be above
+* configMAX_SYSCALL_INTERRUPT_PRIORITY.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void uart_rtos_init(void)
+{
+    uart_fifo_register_callbacks(uart_rtos_tx_done, uart_rtos_rx_done);
+}
+
+/*******************************************************************************
+* Function Name: uart_rtos_write
+********************************************************************************
+* Summary:
+* Writes a buffer and blocks until it has been moved to the TX FIFO.
+*
+* Parameters:
+*  data:    Data to transmit
+*  length:  Number of bytes
+*  timeout: Timeout in ticks
+*
+* Return:
+*  uart_rtos_status_t
+*
+*******************************************************************************/
+uart_rtos_status_t uart_rtos_write(const uint8_t *data, uint32_t length, TickType_t timeout)
+{
+    bool started;
+
+    (void)ulTaskNotifyValueClear(NULL, UART_RTOS_NOTIFY_TX);
+
+    /* The handle is set before the TX ISR can complete the transfer */
+    taskENTER_CRITICAL();
+    started = uart_fifo_write(data, length);
+    if (started)
+    {
+        tx_task = xTaskGetCurrentTaskHandle();
+    }
+    taskEXIT_CRITICAL();
+
+    if (!started)
+    {
+        return UART_RTOS_BUSY;
+    }
+
+    if (!uart_rtos_wait(UART_RTOS_NOTIFY_TX, timeout))
+    {
+        /* The transfer may have completed right after the timeout */
+        if (uart_fifo_write_abort() != length)
+        {
+            return UART_RTOS_TIMEOUT;
+        }
+    }
+
+    return UART_RTOS_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: uart_rtos_read
+********************************************************************************
+* Summary:
+* Reads into a buffer and blocks until it is full or the timeout expires.
+*
+* Parameters:
+*  data:     Buffer for the received data
+*  length:   Number of bytes
+*  received: Number of bytes received, also on timeout (can be NULL)
+*  timeout:  Timeout in ticks
+*
+* Return:
+*  uart_rtos_status_t
+*
+*******************************************************************************/
+uart_rtos_status_t uart_rtos_read(uint8_t *data, uint32_t length, uint32_t *received,
+                                  TickType_t timeout)
+{
+    bool started;
+    uint32_t count = length;
+    uart_rtos_status_t status = UART_RTOS_SUCCESS;
+
+    (void)ulTaskNotifyValueClear(NULL, UART_RTOS_NOTIFY_RX);
+
+    /* The handle is set before the RX ISR can complete the transfer */
+    taskENTER_CRITICAL();
+    started = uart_fifo_read(data, length);
+    if (started)
+    {
+        rx_task = xTaskGetCurrentTaskHandle();
+    }
+    taskEXIT_CRITICAL();
+
+    if (!started)
+    {
+        return UART_RTOS_BUSY;
+    }
+
+    if (!uart_rtos_wait(UART_RTOS_NOTIFY_RX, timeout))
+    {
+        /* The transfer may have completed right after the timeout */
+        count = uart_fifo_read_abort();
+        if (count != length)
+        {
+            status = UART_RTOS_TIMEOUT;
+        }
+    }
+
+    if (received != NULL)
+    {
+        *received = count;
+    }
+
+    return status;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,86 @@
+/******************************************************************************
+* File Name:   uart_rtos.h
+*
+* Description: This file contains the interface of the FreeRTOS binding of the
+*              UART FIFO driver: blocking read and write with timeouts.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#ifndef UART_RTOS_H_
+#define UART_RTOS_H_
+
+#include <stdint.h>
+#include "FreeRTOS.h"
+#include "task.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+/* Task notification bits used to signal the completion from the ISRs */
+#ifndef UART_RTOS_NOTIFY_TX
+#define UART_RTOS_NOTIFY_TX             (1UL << 30U)
+#endif
+#ifndef UART_RTOS_NOTIFY_RX
+#define UART_RTOS_NOTIFY_RX             (1UL << 31U)
+#endif
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+typedef enum
+{
+    UART_RTOS_SUCCESS = 0,
+    UART_RTOS_TIMEOUT,          /* Transfer not completed within the timeout */
+    UART_RTOS_BUSY              /* Another task uses the same direction */
+} uart_rtos_status_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void uart_rtos_init(void);
+uart_rtos_status_t uart_rtos_write(const uint8_t *data, uint32_t length, TickType_t timeout);
+uart_rtos_status_t uart_rtos_read(uint8_t *data, uint32_t length, uint32_t *received,
+                                  TickType_t timeout);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* UART_RTOS_H_ */
+
+/* [] END OF FILE */
@@ -45,6 +45,25 @@
 #include "xmc_gpio.h"
 #include "xmc_uart.h"
 #include "cycfg_peripherals.h"
+#include "uart_config.h"
+#include "uart_async.h"
+#include "uart_autobaud.h"
+#include "uart_baud.h"
+#include "uart_cipher.h"
+#include "uart_coalesce.h"
+#include "uart_crc.h"
+#include "uart_fifo.h"
+#include "uart_log.h"
+#include "uart_pingpong.h"
+#include "uart_prbs.h"
+#include "uart_rx_status.h"
+#include "uart_selftest.h"
+#include "uart_soak.h"
+#include "uart_stats_cmd.h"
+#include "uart_trace.h"
+#if defined(COMPONENT_FREERTOS)
+#include "uart_rtos.h"
+#endif
 
 /*******************************************************************************
 * Defines
@@ -52,11 +71,18 @@
 /* Bytes of data to be transmitted */
 #define NUM_DATA                        9
 
-/* Set interrupt priority for the USIC0_0_IRQn */
-#define USIC0_0_IRQn_PRIORITY           63
+#if defined(COMPONENT_FREERTOS)
+/* Stack size and priorities of the example tasks, the RX task runs first
+ * so that the read is pending before the data is sent
+ */
+#define UART_TASK_STACK_SIZE            (configMINIMAL_STACK_SIZE * 2U)
+#define UART_RX_TASK_PRIORITY           (tskIDLE_PRIORITY + 2U)
+#define UART_TX_TASK_PRIORITY           (tskIDLE_PRIORITY + 1U)
 
-/* Set interrupt priority for the USIC0_1_IRQn */
-#define USIC0_1_IRQn_PRIORITY           62
+/* Period of the loopback transfer and timeout of the read and the write */
+#define UART_TASK_PERIOD_MS             100U
+#define UART_TASK_TIMEOUT_MS            (2U * UART_TASK_PERIOD_MS)
+#endif
 
 #if (UC_FAMILY == XMC1)
 /* Set bit  */
@@ -75,12 +101,6 @@
 /*******************************************************************************
 *  Global Variables
 *******************************************************************************/
-/* TX buffer index */
-uint32_t tx_index = 0;
-
-/* RX buffer index */
-uint32_t rx_index = 0;
-
 /* Flag to set when Rx index equals the total data transmitted */
 volatile uint32_t flag = 0;
 
@@ -90,83 +110,189 @@ uint8_t tx_data[NUM_DATA];
 /* Array for storing the received data */
 uint8_t rx_data[NUM_DATA];
 
+#if (UART_RX_STATUS_ENABLE == 1)
+/* Parity error map of rx_data */
+uint32_t rx_errors[UART_RX_STATUS_WORDS(NUM_DATA)];
+
+/* Received bytes with a parity error and the first of them (NUM_DATA if none) */
+uint32_t rx_parity_errors;
+uint32_t rx_first_error;
+#endif
+
+#if (UART_COALESCE_LATENCY_US != 0U)
+/* FIFO limits selected for the latency budget */
+uart_coalesce_config_t coalesce_config;
+#endif
+
+#if (UART_RUNTIME_BAUDRATE != 0U)
+/* Divider settings and achieved error of UART_RUNTIME_BAUDRATE */
+uart_baud_config_t baud_config;
+#endif
+
+#if (UART_AUTOBAUD_ENABLE == 1)
+/* Result of the automatic baud rate detection */
+uart_autobaud_result_t autobaud_result;
+#endif
+
+#if (UART_TRACE_ENABLE == 1)
+/* CPU cycles per UART_TRACE() call, and whether they exceed UART_TRACE_BUDGET_CYCLES */
+uint32_t trace_cycles_per_event;
+bool trace_over_budget;
+#endif
+
+#if (UART_LOG_ENABLE == 1)
+/* CPU cycles per UART_LOG3() call */
+uint32_t log_cycles_per_record;
+#endif
+
+#if (UART_SELFTEST_ENABLE == 1)
+/* Outcome of the internal loopback self-test */
+uart_selftest_status_t selftest_status;
+uart_selftest_result_t selftest_result;
+#endif
+
+#if (UART_CRC_BENCHMARK == 1)
+/* RX drain cycles with the CRC table in flash and in SRAM */
+uart_crc_benchmark_t crc_benchmark;
+#endif
+
+#if (UART_IRQ_BENCHMARK == 1)
+/* FIFO interrupt cycles including exception entry, tail-chaining and exit */
+uart_fifo_irq_benchmark_t irq_benchmark;
+#endif
+
+#if (UART_CIPHER_ENABLE == 1)
+/* Example key and nonce, provision a secret key per device and never reuse
+ * a nonce with the same key. TX and RX share the nonce here because the
+ * example receives its own transmission.
+ */
+static const uint8_t cipher_key[UART_CIPHER_KEY_SIZE] =
+{
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F
+};
+static const uint8_t cipher_nonce[UART_CIPHER_NONCE_SIZE] =
+{
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x00, 0x00, 0x00, 0x00
+};
+
+/* CPU cycles per byte of keystream generation */
+uint32_t cipher_cycles_per_byte;
+#endif
+
+#if (UART_PRBS_ENABLE == 1)
+/* CPU cycles per byte of PRBS generation and checking */
+uint32_t prbs_cycles_per_byte;
+#endif
+
+#if defined(COMPONENT_FREERTOS)
+/* Outcome of the last loopback transfer of the FreeRTOS example */
+uart_rtos_status_t rtos_rx_status;
+uart_rtos_status_t rtos_tx_status;
+uint32_t rtos_received;
+#endif
+
+#if !defined(COMPONENT_FREERTOS)
 /*******************************************************************************
-* Function Name: USIC0_0_IRQHandler
+* Function Name: rx_done
 ********************************************************************************
 * Summary:
-* Transmit IRQ Handler. The function called everytime the number of elements 
-* in the TX FIFO reduces below TX FIFO Limit (set to one). The function is used 
-* to fill the TX FIFO with the next element in the tx_data buffer.
+* Read completion callback, called from PendSV when all the data has been
+* received. Sets the flag polled by the main loop.
 *
 * Parameters:
+*  buffer: Received data
+*  length: Number of bytes received
+*
+* Return:
 *  void
 *
+*******************************************************************************/
+static void rx_done(const uint8_t *buffer, uint32_t length)
+{
+    CY_UNUSED_PARAMETER(buffer);
+    CY_UNUSED_PARAMETER(length);
+
+    flag = 1;
+}
+#else
+/*******************************************************************************
+* Function Name: uart_rx_task
+********************************************************************************
+* Summary:
+* FreeRTOS task that reads NUM_DATA bytes with a timeout, compares them with
+* the transmitted data and sets the LED. The task is blocked while the FIFO
+* interrupts receive the data.
+*
+* Parameters:
+*  arg: Unused
+*
 * Return:
 *  void
 *
 *******************************************************************************/
-void USIC0_0_IRQHandler(void)
+static void uart_rx_task(void *arg)
 {
-    /* If still remaining data to be send */
-    if(tx_index < NUM_DATA)
-    {
-        /* Wait if the TX FIFO is full */
-        while(XMC_USIC_CH_TXFIFO_IsFull(CYBSP_DEBUG_UART_HW));
-    
-        /* Fill the TX FIFO with the next element in the tx_data buffer */
-        XMC_UART_CH_Transmit(CYBSP_DEBUG_UART_HW, tx_data[tx_index]);
-        tx_index++;
-    }
-    else
+    CY_UNUSED_PARAMETER(arg);
+
+#if (UART_TRACE_ENABLE == 1)
+    /* The scheduler has reprogrammed SysTick to the kernel tick */
+    uart_trace_update_clock();
+#endif
+
+    while(1)
     {
-        /* Disable the TX FIFO Event when all the data in the tx_data
-         * buffer has been transmitted
-         */
-        XMC_USIC_CH_TXFIFO_DisableEvent(CYBSP_DEBUG_UART_HW, 
-                                        XMC_USIC_CH_TXFIFO_EVENT_CONF_STANDARD);
-        NVIC_DisableIRQ(USIC0_0_IRQn);
+        uint32_t errors;
+
+        rtos_rx_status = uart_rtos_read(rx_data, NUM_DATA, &rtos_received,
+                                        pdMS_TO_TICKS(UART_TASK_TIMEOUT_MS));
+
+        /* Missing bytes count as errors */
+        errors = NUM_DATA - rtos_received;
+        for (uint32_t i = 0U; i < rtos_received; i++)
+        {
+            if (tx_data[i] != rx_data[i])
+            {
+                errors++;
+            }
+        }
+
+        XMC_GPIO_SetOutputLevel(CYBSP_USER_LED_PORT, CYBSP_USER_LED_PIN,
+                                (errors == 0U) ? GPIO_OUTPUT_LEVEL_HIGH : GPIO_OUTPUT_LEVEL_LOW);
+        UART_TRACE(UART_TRACE_VERIFY, errors);
     }
 }
 
 /*******************************************************************************
-* Function Name: USIC0_0_IRQHandler
+* Function Name: uart_tx_task
 ********************************************************************************
 * Summary:
-* Receive handling IRQ . The function called everytime the number of elements
-* in the RX FIFO exceeds above Rx FIFO Limit (set to seven). 
-* The function is used to read the RX FIFO until it is empty and set a flag
-* when all the data has been received.
+* FreeRTOS task that writes NUM_DATA bytes every UART_TASK_PERIOD_MS. The
+* task is blocked while the FIFO interrupts transmit the data.
 *
 * Parameters:
-*  void
+*  arg: Unused
 *
 * Return:
 *  void
 *
 *******************************************************************************/
-void USIC0_1_IRQHandler(void) 
+static void uart_tx_task(void *arg)
 {
-    /* Read the RX FIFO till it is empty */
-    while(!XMC_USIC_CH_RXFIFO_IsEmpty(CYBSP_DEBUG_UART_HW))
-    {
-        rx_data[rx_index++] = XMC_UART_CH_GetReceivedData(CYBSP_DEBUG_UART_HW);
-    }
+    CY_UNUSED_PARAMETER(arg);
 
-    /* If all the data have been received */
-    if(rx_index == (NUM_DATA))
+    while(1)
     {
-        flag = 1;
-    }
+#if (UART_CIPHER_ENABLE == 1)
+        /* Generate the keystream ahead of the FIFO interrupts */
+        uart_cipher_process();
+#endif
+        rtos_tx_status = uart_rtos_write(tx_data, NUM_DATA, pdMS_TO_TICKS(UART_TASK_TIMEOUT_MS));
 
-    /* If the remaining data to be received is smaller than the initial
-     * RX FIFO limit, then the RX FIFO limit is modified to the remaining data 
-     * minus 1 in order to trigger interrupt when we have all the data received 
-     */
-    if((NUM_DATA - rx_index) < CYBSP_DEBUG_UART_RXFIFO_LIMIT)
-    {
-        XMC_USIC_CH_RXFIFO_SetSizeTriggerLimit(CYBSP_DEBUG_UART_HW, XMC_USIC_CH_FIFO_SIZE_8WORDS, (NUM_DATA - rx_index) - 1);
+        vTaskDelay(pdMS_TO_TICKS(UART_TASK_PERIOD_MS));
     }
 }
+#endif
 
 /*******************************************************************************
 * Function Name: main
@@ -174,9 +300,13 @@ void USIC0_1_IRQHandler(void)
 * Summary:
 * This is the main function. It performs the following tasks:
 * 1. Initial setup of device.
-* 2. Starts the UART peripheral
-* 3. Fills the TX FIFO for the first time
-* 4. Check if the data transmitted is equal to the data received.
+* 2. Optionally programs a runtime baud rate or detects the baud rate from
+*    a sync character
+* 3. Starts the UART peripheral and the FIFO driver, optionally after a
+*    self-test through the internal loopback
+* 4. Queues the read and the write of the data, or with FreeRTOS starts a
+*    reading and a writing task
+* 5. Check if the data transmitted is equal to the data received.
 *    LED is switched ON in case of successful reception.
 *
 * Parameters:
@@ -203,43 +333,200 @@ int main(void)
         tx_data[i] = i;
     }
 
-    /* Configuring priority and enabling NVIC IRQ 
-     * for the defined Service Request line number 
+#if (UART_RUNTIME_BAUDRATE != 0U)
+    /* Program the requested baud rate, the achieved error is kept in baud_config */
+    if (uart_baud_solve(XMC_SCU_CLOCK_GetPeripheralClockFrequency(), UART_RUNTIME_BAUDRATE,
+                        &baud_config) == UART_BAUD_STATUS_OK)
+    {
+        uart_baud_apply(CYBSP_DEBUG_UART_HW, &baud_config);
+        uart_fifo_set_baudrate(baud_config.baudrate);
+    }
+#endif
+
+#if (UART_AUTOBAUD_ENABLE == 1)
+    /* Wait for the sync character from the peer and adopt its baud rate.
+     * On timeout the baud rate from design.modus is kept.
      */
-    NVIC_SetPriority(USIC0_0_IRQn, USIC0_0_IRQn_PRIORITY);
-    NVIC_EnableIRQ(USIC0_0_IRQn);
-    NVIC_EnableIRQ(USIC0_1_IRQn);
-    NVIC_SetPriority(USIC0_1_IRQn, USIC0_1_IRQn_PRIORITY);
+    if (uart_autobaud_detect(CYBSP_DEBUG_UART_HW, UART_AUTOBAUD_TIMEOUT,
+                             &autobaud_result) == UART_AUTOBAUD_STATUS_OK)
+    {
+        uart_fifo_set_baudrate(autobaud_result.baudrate);
+    }
+#endif
+
+#if (UART_TX_FIFO_SIZE != UART_FIFO_SIZE) || (UART_RX_FIFO_SIZE != UART_FIFO_SIZE)
+    /* Repartition the USIC0 FIFO RAM between the TX and the RX FIFO */
+    (void)uart_fifo_set_sizes(UART_TX_FIFO_SIZE, UART_RX_FIFO_SIZE);
+#endif
+
+#if (UART_COALESCE_LATENCY_US != 0U)
+    /* Select the FIFO limits for the latency budget */
+    uart_coalesce_compute(uart_fifo_baudrate(), uart_fifo_frame_bits(), UART_COALESCE_LATENCY_US,
+                          UART_RX_FIFO_SIZE, &coalesce_config);
+    uart_fifo_set_limits(coalesce_config.tx_limit, coalesce_config.rx_limit);
+
+    /* Start the fallback timer that drains a stream tail below the RX limit.
+     * Without it a tail would wait for more data, so every byte raises the
+     * RX interrupt then.
+     */
+    if ((coalesce_config.timer_period_us != 0U) && !uart_fifo_start_timer(coalesce_config.timer_period_us))
+    {
+        coalesce_config.rx_limit = 0U;
+        uart_fifo_set_limits(coalesce_config.tx_limit, coalesce_config.rx_limit);
+    }
+#endif
+
+    /* Configure the FIFO interrupts and the asynchronous completion */
+    uart_fifo_init();
+#if (UART_IRQ_BENCHMARK == 1)
+    uart_fifo_irq_benchmark(&irq_benchmark);
+#endif
+#if (UART_TRACE_ENABLE == 1)
+    trace_cycles_per_event = uart_trace_benchmark();
+    trace_over_budget = (trace_cycles_per_event > UART_TRACE_BUDGET_CYCLES);
+#endif
+#if (UART_LOG_ENABLE == 1)
+    log_cycles_per_record = uart_log_benchmark();
+#endif
+#if (UART_CRC_BENCHMARK == 1)
+    uart_crc_benchmark(&crc_benchmark);
+#endif
+#if (UART_CIPHER_ENABLE == 1)
+    /* Measure the keystream generation, then encrypt both directions */
+    cipher_cycles_per_byte = uart_cipher_benchmark(16U);
+    uart_cipher_init(cipher_key, cipher_nonce, cipher_nonce);
+#endif
+#if (UART_SELFTEST_ENABLE == 1)
+    /* Test the TX and RX FIFO paths through the internal loopback before the
+     * RX pin is used
+     */
+    selftest_status = uart_selftest_run(&selftest_result);
+    UART_LOG3(UART_LOG_SELFTEST, selftest_status, selftest_result.errors, selftest_result.throughput_bps);
+#if (UART_CIPHER_ENABLE == 1)
+    /* Restart both keystreams in step with the peer */
+    uart_cipher_init(cipher_key, cipher_nonce, cipher_nonce);
+#endif
+#endif
+#if !defined(COMPONENT_FREERTOS)
+    uart_async_init();
+#else
+    /* PendSV belongs to the kernel, the tasks are woken from the FIFO
+     * interrupts instead
+     */
+    uart_rtos_init();
+#endif
+#if (UART_STATS_CMD_ENABLE == 1)
+    uart_stats_cmd_init();
+#endif
 
     /* Start the UART peripheral */ 
     XMC_UART_CH_Start(CYBSP_DEBUG_UART_HW);
+    UART_LOG1(UART_LOG_START, uart_fifo_baudrate());
 
-    /* Wait until the TX FIFO is has some space to accommodate more data */
-    while(XMC_USIC_CH_TXFIFO_IsFull (CYBSP_DEBUG_UART_HW));
+#if (UART_PRBS_ENABLE == 1)
+    /* Measure generator and checker, then stream the PRBS through TX and RX
+     * without buffers. The LED is on while the checker is locked and error-free.
+     */
+    prbs_cycles_per_byte = uart_prbs_benchmark(UART_PRBS_ORDER, 1024U);
+    uart_prbs_init(UART_PRBS_ORDER);
+    uart_fifo_register_callbacks(NULL, NULL);
+    while(1)
+    {
+        if (!uart_fifo_rx_busy())
+        {
+            (void)uart_fifo_read(NULL, UINT32_MAX);
+        }
+        if (!uart_fifo_tx_busy())
+        {
+            (void)uart_fifo_write(NULL, UINT32_MAX);
+        }
+
+        XMC_GPIO_SetOutputLevel(CYBSP_USER_LED_PORT, CYBSP_USER_LED_PIN,
+                                (uart_prbs_checker.locked && (uart_prbs_checker.bit_errors == 0U)) ?
+                                GPIO_OUTPUT_LEVEL_HIGH : GPIO_OUTPUT_LEVEL_LOW);
+    }
+#endif
+
+#if (UART_SOAK_ENABLE == 1)
+    /* Loop pseudo-random frames forever, the LED stays on while no frame failed */
+    uart_soak_init();
+    XMC_GPIO_SetOutputLevel(CYBSP_USER_LED_PORT, CYBSP_USER_LED_PIN, GPIO_OUTPUT_LEVEL_HIGH);
+    while(1)
+    {
+        if (!uart_soak_iteration())
+        {
+            XMC_GPIO_SetOutputLevel(CYBSP_USER_LED_PORT, CYBSP_USER_LED_PIN, GPIO_OUTPUT_LEVEL_LOW);
+        }
+    }
+#endif
 
-    /* Filling the the first time TX FIFO. Successive fillings will be done in the TX FIFO IRQ */
-    XMC_UART_CH_Transmit(CYBSP_DEBUG_UART_HW, tx_data[tx_index++]);
+#if (UART_PINGPONG_ENABLE == 1)
+    /* Stream a counter sequence into two alternating RX buffers and process
+     * them with a slow consumer, the LED stays on while no byte was lost
+     */
+    uart_pingpong_benchmark_init();
+    XMC_GPIO_SetOutputLevel(CYBSP_USER_LED_PORT, CYBSP_USER_LED_PIN, GPIO_OUTPUT_LEVEL_HIGH);
+    while(1)
+    {
+        if (!uart_pingpong_benchmark_iteration())
+        {
+            XMC_GPIO_SetOutputLevel(CYBSP_USER_LED_PORT, CYBSP_USER_LED_PIN, GPIO_OUTPUT_LEVEL_LOW);
+        }
+    }
+#endif
 
-    /* If the total data data to be transmitted is smaller than the initial RX FIFO Limit
-     * then RX FIFO limit is modified to the total data to be transmitted minus 1 in order 
-     * react when we have all the data received 
+#if defined(COMPONENT_FREERTOS)
+    /* Receive and transmit from two tasks, successive fillings and drainings
+     * of the FIFOs will be done in the FIFO IRQs
      */
-    if((NUM_DATA - rx_index) < CYBSP_DEBUG_UART_RXFIFO_LIMIT)
+    if ((xTaskCreate(uart_rx_task, "uart_rx", UART_TASK_STACK_SIZE, NULL,
+                     UART_RX_TASK_PRIORITY, NULL) != pdPASS) ||
+        (xTaskCreate(uart_tx_task, "uart_tx", UART_TASK_STACK_SIZE, NULL,
+                     UART_TX_TASK_PRIORITY, NULL) != pdPASS))
+    {
+        CY_ASSERT(0);
+    }
+    vTaskStartScheduler();
+
+    /* Only reached if the idle task could not be created */
+    CY_ASSERT(0);
+    while(1)
     {
-        XMC_USIC_CH_RXFIFO_SetSizeTriggerLimit(CYBSP_DEBUG_UART_HW, XMC_USIC_CH_FIFO_SIZE_8WORDS, (NUM_DATA - rx_index) - 1);
     }
+#else
+    /* Receive into rx_data and transmit tx_data. Successive fillings and
+     * drainings of the FIFOs will be done in the FIFO IRQs
+     */
+#if (UART_RX_STATUS_ENABLE == 1)
+    uart_rx_async_status(rx_data, rx_errors, NUM_DATA, rx_done);
+#else
+    uart_rx_async(rx_data, NUM_DATA, rx_done);
+#endif
+    uart_tx_async(tx_data, NUM_DATA, NULL);
 
     while(1)
     {
+#if (UART_LOG_ENABLE == 1)
+        /* Format and send the log records in the background, behind tx_data */
+        uart_log_process();
+#endif
+#if (UART_CIPHER_ENABLE == 1)
+        /* Generate the keystream ahead of the FIFO interrupts */
+        uart_cipher_process();
+#endif
+
         /* Infinite loop */
         if (flag == 1)
         {
+            uint32_t errors = 0U;
+
             /* Check if every received data match with the transmitted data */
             for (int tmp = 0; tmp < NUM_DATA; tmp++)
             {
                 /* If reception fails stays in an infinite while loop and switch off the LED */
                 if (tx_data[tmp] != rx_data[tmp])
                 {
+                    errors++;
                     XMC_GPIO_SetOutputLevel(CYBSP_USER_LED_PORT, CYBSP_USER_LED_PIN, GPIO_OUTPUT_LEVEL_LOW);
                 }
                 /* If reception is successful turn on the LED */
@@ -248,11 +535,20 @@ int main(void)
                     XMC_GPIO_SetOutputLevel(CYBSP_USER_LED_PORT, CYBSP_USER_LED_PIN, GPIO_OUTPUT_LEVEL_HIGH);
                 }
             }
+#if (UART_RX_STATUS_ENABLE == 1)
+            /* Locate the bytes received with a parity error */
+            rx_parity_errors = uart_rx_status_count(rx_errors, NUM_DATA);
+            rx_first_error = uart_rx_status_next(rx_errors, NUM_DATA, 0U);
+            errors += rx_parity_errors;
+#endif
+            UART_TRACE(UART_TRACE_VERIFY, errors);
+            UART_LOG2(UART_LOG_VERIFY, errors, NUM_DATA);
 
             /* Reset the flag to zero */
             flag = 0;
         }
     }
+#endif
 }
 
 /* [] END OF FILE */
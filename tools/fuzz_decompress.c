@@ -0,0 +1,180 @@
+/******************************************************************************
+* File Name:   fuzz_decompress.c
+*
+* Description: Fuzz target of the decompressor in uart_compress.c. The first
+*              input byte selects the piece sizes; the rest is decompressed as
+*              a received stream, which must not overrun the output or stall,
+*              and is compressed and decompressed again, which must give the
+*              data back.
+*              Build:  make -C tools fuzz (libFuzzer) or fuzz_replay
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "uart_compress.h"
+
+/*******************************************************************************
+*  Global Variables
+*******************************************************************************/
+static uart_compress_t compress;
+static uart_decompress_t decompress;
+static uint8_t block[UART_COMPRESS_BOUND(UART_COMPRESS_BLOCK_SIZE)];
+static uint8_t output[UART_COMPRESS_BLOCK_SIZE];
+
+/*******************************************************************************
+* Function Name: fuzz_stream
+********************************************************************************
+* Summary:
+* Decompresses arbitrary input in pieces into a small output. Every call with
+* input left and room in the output must consume or produce a byte.
+*
+* Parameters:
+*  data:  Received stream
+*  size:  Number of bytes
+*  piece: Received bytes per call
+*  room:  Room in the output per call
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void fuzz_stream(const uint8_t *data, size_t size, uint32_t piece, uint32_t room)
+{
+    size_t offset = 0U;
+
+    uart_decompress_init(&decompress);
+    while (offset < size)
+    {
+        uint32_t length = ((size - offset) < piece) ? (uint32_t)(size - offset) : piece;
+        uint32_t consumed = 0U;
+        uint32_t produced = uart_decompress(&decompress, &data[offset], length, &consumed, output, room);
+
+        if ((consumed > length) || (produced > room) || ((consumed == 0U) && (produced == 0U)))
+        {
+            __builtin_trap();
+        }
+        offset += consumed;
+    }
+}
+
+/*******************************************************************************
+* Function Name: fuzz_round_trip
+********************************************************************************
+* Summary:
+* Compresses the data in blocks as uart_compress_tx_async() does and
+* decompresses each block in pieces; the output must equal the block data.
+*
+* Parameters:
+*  data:  Data to send
+*  size:  Number of bytes
+*  piece: Received bytes per call
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void fuzz_round_trip(const uint8_t *data, size_t size, uint32_t piece)
+{
+    size_t offset = 0U;
+
+    uart_compress_init(&compress);
+    uart_decompress_init(&decompress);
+    while (offset < size)
+    {
+        uint32_t length = ((size - offset) < UART_COMPRESS_BLOCK_SIZE) ? (uint32_t)(size - offset) :
+                          UART_COMPRESS_BLOCK_SIZE;
+        uint32_t sent = uart_compress_block(&compress, &data[offset], length, block);
+        uint32_t received = 0U;
+        uint32_t total = 0U;
+
+        if (sent > sizeof(block))
+        {
+            __builtin_trap();
+        }
+        while (received < sent)
+        {
+            uint32_t count = ((sent - received) < piece) ? (sent - received) : piece;
+            uint32_t consumed;
+
+            total += uart_decompress(&decompress, &block[received], count, &consumed, &output[total],
+                                     (uint32_t)(sizeof(output) - total));
+            if (consumed == 0U)
+            {
+                __builtin_trap();
+            }
+            received += consumed;
+        }
+        if ((total != length) || (memcmp(output, &data[offset], length) != 0))
+        {
+            __builtin_trap();
+        }
+        offset += length;
+    }
+}
+
+/*******************************************************************************
+* Function Name: LLVMFuzzerTestOneInput
+********************************************************************************
+* Summary:
+* Entry of libFuzzer and of the replay driver fuzz_main.c.
+*
+* Parameters:
+*  data: Input
+*  size: Number of input bytes
+*
+* Return:
+*  int: 0
+*
+*******************************************************************************/
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    uint32_t piece;
+    uint32_t room;
+
+    if (size == 0U)
+    {
+        return 0;
+    }
+    piece = 1U + (data[0] & 0x0FU);
+    room = 1U + (data[0] >> 4);
+
+    fuzz_stream(&data[1], size - 1U, piece, room);
+    fuzz_round_trip(&data[1], size - 1U, piece);
+
+    return 0;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,97 @@
+/******************************************************************************
+* File Name:   fuzz_log_decode.c
+*
+* Description: Fuzz target of the deferred log decoder in uart_log_decode.c. The
+*              first input byte selects the escape handling and the timestamp
+*              counter; the rest is decoded as a serial capture.
+*              Build:  make -C tools fuzz (libFuzzer) or fuzz_replay
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include "uart_log_decode.h"
+
+/*******************************************************************************
+*  Global Variables
+*******************************************************************************/
+static uart_log_decoder_t decoder;
+static FILE *sink;
+
+/*******************************************************************************
+* Function Name: LLVMFuzzerTestOneInput
+********************************************************************************
+* Summary:
+* Entry of libFuzzer and of the replay driver fuzz_main.c. The text lines go
+* to /dev/null.
+*
+* Parameters:
+*  data: Input
+*  size: Number of input bytes
+*
+* Return:
+*  int: 0
+*
+*******************************************************************************/
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    if (size == 0U)
+    {
+        return 0;
+    }
+    if (sink == NULL)
+    {
+        sink = fopen("/dev/null", "w");
+        if (sink == NULL)
+        {
+            return 0;
+        }
+    }
+
+    uart_log_decoder_init(&decoder, ((data[0] & 2U) != 0U) ? 1000000U : 0U,
+                          ((data[0] & 4U) != 0U) ? 0x1000000U : 0U, (data[0] & 1U) != 0U, sink);
+    for (size_t i = 1U; i < size; i++)
+    {
+        uart_log_decode_byte(&decoder, data[i]);
+        if (decoder.count >= sizeof(decoder.window))
+        {
+            __builtin_trap();
+        }
+    }
+
+    return 0;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,151 @@
+/******************************************************************************
+* File Name:   fuzz_main.c
+*
+* Description: Replay driver of the fuzz targets for compilers without libFuzzer.
+*              Runs LLVMFuzzerTestOneInput() once per file given, or on stdin,
+*              for example on a corpus or a crash input of libFuzzer.
+*              Usage:  ./fuzz_drain_replay file... | -
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+/*******************************************************************************
+* Function Name: fuzz_replay
+********************************************************************************
+* Summary:
+* Reads a file completely and passes it to the fuzz target.
+*
+* Parameters:
+*  path: File name, "-" for stdin
+*
+* Return:
+*  int: 0, 1 if the file can not be read
+*
+*******************************************************************************/
+static int fuzz_replay(const char *path)
+{
+    FILE *file = (strcmp(path, "-") == 0) ? stdin : fopen(path, "rb");
+    uint8_t *data = NULL;
+    uint8_t *input;
+    size_t size = 0U;
+    size_t capacity = 0U;
+    size_t length;
+
+    if (file == NULL)
+    {
+        perror(path);
+        return 1;
+    }
+    do
+    {
+        if (size == capacity)
+        {
+            uint8_t *grown;
+
+            capacity = (capacity == 0U) ? 4096U : (2U * capacity);
+            grown = realloc(data, capacity);
+            if (grown == NULL)
+            {
+                free(data);
+                if (file != stdin)
+                {
+                    fclose(file);
+                }
+                return 1;
+            }
+            data = grown;
+        }
+        length = fread(&data[size], 1U, capacity - size, file);
+        size += length;
+    } while (length != 0U);
+    if (file != stdin)
+    {
+        fclose(file);
+    }
+
+    /* Pass an exact copy, so that ASan finds reads past the input */
+    input = malloc((size != 0U) ? size : 1U);
+    if (input != NULL)
+    {
+        memcpy(input, data, size);
+        (void)LLVMFuzzerTestOneInput(input, size);
+        free(input);
+    }
+    free(data);
+
+    return 0;
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* Replays every input given on the command line.
+*
+* Parameters:
+*  argc: Argument count
+*  argv: Arguments
+*
+* Return:
+*  int
+*
+*******************************************************************************/
+int main(int argc, char *argv[])
+{
+    int status = 0;
+
+    if (argc < 2)
+    {
+        fprintf(stderr, "usage: %s file... | -\n", argv[0]);
+        return 1;
+    }
+    for (int i = 1; i < argc; i++)
+    {
+        status |= fuzz_replay(argv[i]);
+    }
+
+    return status;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,73 @@
+/******************************************************************************
+* File Name:   cycfg_peripherals.h
+*
+* Description: Host model of the board support of the UART FIFO driver:
+*              the debug UART channel and its FIFO limits from design.modus.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#ifndef CYCFG_PERIPHERALS_H
+#define CYCFG_PERIPHERALS_H
+
+#include "xmc_uart.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+#define CYBSP_DEBUG_UART_HW             (&uart_model_channel)
+
+/* FIFO limits of the example configuration */
+#ifndef CYBSP_DEBUG_UART_RXFIFO_LIMIT
+#define CYBSP_DEBUG_UART_RXFIFO_LIMIT   7U
+#endif
+#ifndef CYBSP_DEBUG_UART_TXFIFO_LIMIT
+#define CYBSP_DEBUG_UART_TXFIFO_LIMIT   1U
+#endif
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+extern XMC_USIC_CH_t uart_model_channel;
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* CYCFG_PERIPHERALS_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,1074 @@
+/******************************************************************************
+* File Name:   uart_model.c
+*
+* Description: Host model of the USIC channel FIFOs and the NVIC for the
+*              UART FIFO driver. Every register access counts as one cycle
+*              of the DWT cycle counter, so uart_stats.isr_cycles holds the
+*              register accesses of the handlers.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "uart_model.h"
+#include "uart_config.h"
+#include "cybsp.h"
+#include "xmc_ccu4.h"
+#include "xmc_scu.h"
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+/* Exception and interrupt numbers from PendSV_IRQn on */
+#define UART_MODEL_IRQ_OFFSET           2
+#define UART_MODEL_IRQ_COUNT            32U
+
+/* Bytes passing the line while the driver reads the RX FIFO level */
+#define UART_MODEL_LEVEL_BYTES          3U
+
+/* Pended interrupts served per call before the model reports a storm */
+#define UART_MODEL_STORM                1000U
+
+/* Cycles of one iteration of a busy-wait loop */
+#define UART_MODEL_POLL_CYCLES          16U
+
+/* TX FIFO events go to service request 0, RX FIFO events to 1 by default */
+#define UART_MODEL_TX_SERVICE_REQUEST   0U
+#define UART_MODEL_RX_SERVICE_REQUEST   1U
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+typedef struct
+{
+    uint8_t data[UART_MODEL_FIFO_MAX];
+    uint32_t head;
+    uint32_t level;
+    uint32_t size;
+    uint32_t limit;
+} uart_model_fifo_t;
+
+typedef void (*uart_model_handler_t)(void);
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/* Handlers of the driver; a handler not built in this configuration is NULL */
+extern void USIC0_0_IRQHandler(void) __attribute__((weak));
+extern void USIC0_1_IRQHandler(void) __attribute__((weak));
+extern void SysTick_Handler(void) __attribute__((weak));
+extern void CCU40_0_IRQHandler(void) __attribute__((weak));
+
+/*******************************************************************************
+*  Global Variables
+*******************************************************************************/
+XMC_USIC_CH_t uart_model_channel;
+SysTick_Type uart_model_systick;
+SCB_Type uart_model_scb;
+DWT_Type uart_model_dwt;
+CoreDebug_Type uart_model_core_debug;
+uint32_t SystemCoreClock = 144000000U;
+
+uart_model_stats_t uart_model_stats;
+
+XMC_CCU4_MODULE_t uart_model_ccu40;
+XMC_CCU4_SLICE_t uart_model_ccu40_cc42;
+XMC_CCU4_SLICE_t uart_model_ccu40_cc43;
+
+static uart_model_fifo_t tx_fifo;
+static uart_model_fifo_t rx_fifo;
+static bool tx_event_enabled;
+static uint32_t tx_event;
+static uint32_t rx_event;
+static uint32_t rx_service_request;
+
+static uint32_t primask;
+static bool irq_pending[UART_MODEL_IRQ_COUNT];
+static bool irq_enabled[UART_MODEL_IRQ_COUNT];
+static uint32_t irq_priority[UART_MODEL_IRQ_COUNT];
+
+static bool in_handler;
+static uint32_t handler_irq;
+static uint32_t entry_reads;
+static uint32_t entry_writes;
+static uart_model_control_t control;
+static uart_model_corrupt_t line_corrupt;
+static uint32_t line_cycles;
+static uint32_t line_time;
+static uint32_t timer_time;
+
+/*******************************************************************************
+* Function Name: uart_model_violation
+********************************************************************************
+* Summary:
+* Reports a driver access that the hardware would not allow.
+*
+* Parameters:
+*  what: Description
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void uart_model_violation(const char *what)
+{
+    uart_model_stats.violations++;
+    fprintf(stderr, "uart_model: %s\n", what);
+}
+
+/*******************************************************************************
+* Function Name: uart_model_access
+********************************************************************************
+* Summary:
+* Accounts one peripheral register access as one cycle.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void uart_model_access(void)
+{
+    uart_model_stats.accesses++;
+    uart_model_dwt.CYCCNT++;
+}
+
+/*******************************************************************************
+* Function Name: uart_model_irq
+********************************************************************************
+* Summary:
+* Returns the table index of an exception or interrupt number.
+*
+* Parameters:
+*  irq: Exception or interrupt number
+*
+* Return:
+*  uint32_t: Table index
+*
+*******************************************************************************/
+static uint32_t uart_model_irq(IRQn_Type irq)
+{
+    return (uint32_t)((int32_t)irq + UART_MODEL_IRQ_OFFSET);
+}
+
+/*******************************************************************************
+* Function Name: uart_model_handler
+********************************************************************************
+* Summary:
+* Returns the handler of a table index, NULL if the driver has none.
+*
+* Parameters:
+*  index: Table index
+*
+* Return:
+*  uart_model_handler_t
+*
+*******************************************************************************/
+static uart_model_handler_t uart_model_handler(uint32_t index)
+{
+    if (index == uart_model_irq(USIC0_0_IRQn))
+    {
+        return USIC0_0_IRQHandler;
+    }
+    if (index == uart_model_irq(USIC0_1_IRQn))
+    {
+        return USIC0_1_IRQHandler;
+    }
+    if (index == uart_model_irq(SysTick_IRQn))
+    {
+        return SysTick_Handler;
+    }
+    if (index == uart_model_irq(CCU40_0_IRQn))
+    {
+        return CCU40_0_IRQHandler;
+    }
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: uart_model_size
+********************************************************************************
+* Summary:
+* Returns the words of a FIFO size code.
+*
+* Parameters:
+*  size: FIFO size code
+*
+* Return:
+*  uint32_t: Words
+*
+*******************************************************************************/
+static uint32_t uart_model_size(XMC_USIC_CH_FIFO_SIZE_t size)
+{
+    return (size == XMC_USIC_CH_FIFO_DISABLED) ? 0U : (1UL << (uint32_t)size);
+}
+
+/*******************************************************************************
+* Function Name: uart_model_pop
+********************************************************************************
+* Summary:
+* Removes the oldest entry of a FIFO.
+*
+* Parameters:
+*  fifo: FIFO, not empty
+*
+* Return:
+*  uint8_t: Entry
+*
+*******************************************************************************/
+static uint8_t uart_model_pop(uart_model_fifo_t *fifo)
+{
+    uint8_t data = fifo->data[fifo->head];
+
+    fifo->head = (fifo->head + 1U) % UART_MODEL_FIFO_MAX;
+    fifo->level--;
+    return data;
+}
+
+/*******************************************************************************
+* Function Name: uart_model_push
+********************************************************************************
+* Summary:
+* Appends an entry to a FIFO.
+*
+* Parameters:
+*  fifo: FIFO, not full
+*  data: Entry
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void uart_model_push(uart_model_fifo_t *fifo, uint8_t data)
+{
+    fifo->data[(fifo->head + fifo->level) % UART_MODEL_FIFO_MAX] = data;
+    fifo->level++;
+}
+
+/*******************************************************************************
+* Function Name: uart_model_inject
+********************************************************************************
+* Summary:
+* Receives a byte into the RX FIFO. The standard RX event occurs when the
+* level rises from the limit to the limit + 1; a byte arriving at a full RX
+* FIFO is lost. The loss is the interrupt latency if the RX interrupt is
+* pending or running, else the driver missed the event.
+*
+* Parameters:
+*  data: Received byte
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void uart_model_inject(uint8_t data)
+{
+    IRQn_Type rx_irqn = (IRQn_Type)((uint32_t)USIC0_0_IRQn + rx_service_request);
+    uint32_t rx_irq = uart_model_irq(rx_irqn);
+
+    if (rx_fifo.level >= rx_fifo.size)
+    {
+        uart_model_stats.overflows++;
+        if (!irq_pending[rx_irq] && !(in_handler && (handler_irq == rx_irq)))
+        {
+            uart_model_violation("RX FIFO overflow without a pending RX interrupt");
+        }
+        return;
+    }
+
+    uart_model_push(&rx_fifo, data);
+    if (rx_fifo.level == (rx_fifo.limit + 1U))
+    {
+        rx_event |= XMC_USIC_CH_RXFIFO_EVENT_STANDARD;
+        NVIC_SetPendingIRQ(rx_irqn);
+    }
+}
+
+/*******************************************************************************
+* Function Name: uart_model_line
+********************************************************************************
+* Summary:
+* Lets byte times pass: the transmitter takes one entry of the TX FIFO per
+* byte time and the receiver stores it in the RX FIFO. The standard TX event
+* occurs when the level falls from the limit to the limit - 1.
+*
+* Parameters:
+*  bytes: Byte times
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void uart_model_line(uint32_t bytes)
+{
+    while ((bytes != 0U) && (tx_fifo.level != 0U))
+    {
+        uint8_t data = uart_model_pop(&tx_fifo);
+
+        if (tx_fifo.level == (tx_fifo.limit - 1U))
+        {
+            tx_event |= XMC_USIC_CH_TXFIFO_EVENT_STANDARD;
+            if (tx_event_enabled)
+            {
+                NVIC_SetPendingIRQ((IRQn_Type)((uint32_t)USIC0_0_IRQn + UART_MODEL_TX_SERVICE_REQUEST));
+            }
+        }
+        uart_model_inject((line_corrupt != NULL) ? line_corrupt(data) : data);
+        bytes--;
+    }
+}
+
+/*******************************************************************************
+* Function Name: uart_model_arrive
+********************************************************************************
+* Summary:
+* Inside a handler, the control source lets up to UART_MODEL_LEVEL_BYTES - 1
+* bytes arrive before an RX FIFO level read or limit write, so that every
+* batch of the drain can find new data and a limit can be set below the level.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void uart_model_arrive(void)
+{
+    if (in_handler && (control != NULL))
+    {
+        uart_model_line(control() % UART_MODEL_LEVEL_BYTES);
+    }
+}
+
+/*******************************************************************************
+* Function Name: uart_model_level_read
+********************************************************************************
+* Summary:
+* Accounts an RX FIFO level read.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void uart_model_level_read(void)
+{
+    uart_model_access();
+    uart_model_stats.level_reads++;
+    uart_model_arrive();
+}
+
+/*******************************************************************************
+* Function Name: uart_model_reset
+********************************************************************************
+* Summary:
+* Resets the model to empty FIFOs. The first reset configures UART_FIFO_SIZE
+* words with the limits and the 8N1 frame of the example configuration; later
+* resets keep the sizes and limits the driver has set, like the hardware does.
+*
+* Parameters:
+*  source: Control source of the adversarial choices (can be NULL)
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void uart_model_reset(uart_model_control_t source)
+{
+    if (tx_fifo.size == 0U)
+    {
+        tx_fifo.size = UART_FIFO_SIZE;
+        tx_fifo.limit = CYBSP_DEBUG_UART_TXFIFO_LIMIT;
+        rx_fifo.size = UART_FIFO_SIZE;
+        rx_fifo.limit = CYBSP_DEBUG_UART_RXFIFO_LIMIT;
+
+        /* 8 data bits, no parity, 1 stop bit as in design.modus */
+        uart_model_channel.SCTR = 7UL << USIC_CH_SCTR_FLE_Pos;
+    }
+    uart_model_flush();
+    tx_event_enabled = false;
+    tx_event = 0U;
+    rx_event = 0U;
+    rx_service_request = UART_MODEL_RX_SERVICE_REQUEST;
+
+    primask = 0U;
+    memset(irq_pending, 0, sizeof(irq_pending));
+    memset(irq_enabled, 0, sizeof(irq_enabled));
+    memset(irq_priority, 0, sizeof(irq_priority));
+    irq_enabled[uart_model_irq(SysTick_IRQn)] = true;
+
+    memset(&uart_model_ccu40, 0, sizeof(uart_model_ccu40));
+    memset(&uart_model_ccu40_cc42, 0, sizeof(uart_model_ccu40_cc42));
+    memset(&uart_model_ccu40_cc43, 0, sizeof(uart_model_ccu40_cc43));
+
+    memset(&uart_model_stats, 0, sizeof(uart_model_stats));
+    in_handler = false;
+    control = source;
+    line_corrupt = NULL;
+    line_cycles = 0U;
+}
+
+/*******************************************************************************
+* Function Name: uart_model_flush
+********************************************************************************
+* Summary:
+* Empties both FIFOs and the pending events, as after a lost transfer.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void uart_model_flush(void)
+{
+    tx_fifo.level = 0U;
+    rx_fifo.level = 0U;
+    tx_event = 0U;
+    rx_event = 0U;
+}
+
+/*******************************************************************************
+* Function Name: uart_model_run_interrupts
+********************************************************************************
+* Summary:
+* Runs the pending enabled handlers by priority until none is pending and
+* checks the entries against UART_ISR_MAX_BYTES. Handlers do not preempt
+* each other; data arriving during a handler is modeled by the level reads.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void uart_model_run_interrupts(void)
+{
+    uint32_t runs = 0U;
+
+    if (primask != 0U)
+    {
+        uart_model_violation("interrupts left disabled");
+        primask = 0U;
+    }
+
+    for (;;)
+    {
+        uint32_t best = UART_MODEL_IRQ_COUNT;
+        uart_model_handler_t handler;
+
+        for (uint32_t i = 0U; i < UART_MODEL_IRQ_COUNT; i++)
+        {
+            if (irq_pending[i] && irq_enabled[i] && (uart_model_handler(i) != NULL) &&
+                ((best == UART_MODEL_IRQ_COUNT) || (irq_priority[i] < irq_priority[best])))
+            {
+                best = i;
+            }
+        }
+        if (best == UART_MODEL_IRQ_COUNT)
+        {
+            break;
+        }
+        if (++runs > UART_MODEL_STORM)
+        {
+            uart_model_violation("interrupt storm");
+            break;
+        }
+
+        irq_pending[best] = false;
+        handler = uart_model_handler(best);
+        in_handler = true;
+        handler_irq = best;
+        entry_reads = 0U;
+        entry_writes = 0U;
+        uart_model_stats.entries++;
+        handler();
+        in_handler = false;
+
+        if (entry_reads > uart_model_stats.entry_reads_max)
+        {
+            uart_model_stats.entry_reads_max = entry_reads;
+        }
+        if (entry_writes > uart_model_stats.entry_writes_max)
+        {
+            uart_model_stats.entry_writes_max = entry_writes;
+        }
+#if (UART_ISR_MAX_BYTES != 0U)
+        if ((entry_reads > UART_ISR_MAX_BYTES) || (entry_writes > UART_ISR_MAX_BYTES))
+        {
+            uart_model_violation("handler entry moved more than UART_ISR_MAX_BYTES");
+        }
+#endif
+        if (primask != 0U)
+        {
+            uart_model_violation("handler left interrupts disabled");
+            primask = 0U;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: uart_model_set_line
+********************************************************************************
+* Summary:
+* Sets the line timing for uart_model_poll() and an optional line error. The
+* byte times are counted from the current cycle counter value.
+*
+* Parameters:
+*  byte_cycles: CPU cycles per byte on the line, 0 = no line progress
+*  corrupt:     Line error applied to every byte sent (can be NULL)
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void uart_model_set_line(uint32_t byte_cycles, uart_model_corrupt_t corrupt)
+{
+    line_cycles = byte_cycles;
+    line_time = uart_model_dwt.CYCCNT;
+    timer_time = uart_model_dwt.CYCCNT;
+    line_corrupt = corrupt;
+}
+
+/*******************************************************************************
+* Function Name: uart_model_poll
+********************************************************************************
+* Summary:
+* Busy-waiting of the application: the cycle counter advances to the next
+* byte time or timer period, since nothing changes in between, at least by
+* one loop iteration. The line moves one byte per byte time, the coalescing
+* timer ends its periods, and the pending interrupts run.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void uart_model_poll(void)
+{
+    uint32_t timer_cycles;
+    uint32_t wait;
+
+    if (line_cycles == 0U)
+    {
+        uart_model_dwt.CYCCNT += UART_MODEL_POLL_CYCLES;
+        uart_model_run_interrupts();
+        return;
+    }
+
+    timer_cycles = (uint32_t)(((uint64_t)uart_model_timer_period_us() * SystemCoreClock) / 1000000U);
+    wait = line_time + line_cycles - uart_model_dwt.CYCCNT;
+    if ((timer_cycles != 0U) && ((timer_time + timer_cycles - uart_model_dwt.CYCCNT) < wait))
+    {
+        wait = timer_time + timer_cycles - uart_model_dwt.CYCCNT;
+    }
+    uart_model_dwt.CYCCNT += ((wait > UART_MODEL_POLL_CYCLES) && (wait <= line_cycles)) ? wait :
+                             UART_MODEL_POLL_CYCLES;
+
+    while ((uint32_t)(uart_model_dwt.CYCCNT - line_time) >= line_cycles)
+    {
+        line_time += line_cycles;
+        uart_model_line(1U);
+    }
+
+    if (timer_cycles == 0U)
+    {
+        timer_time = uart_model_dwt.CYCCNT;
+    }
+    while ((timer_cycles != 0U) && ((uint32_t)(uart_model_dwt.CYCCNT - timer_time) >= timer_cycles))
+    {
+        timer_time += timer_cycles;
+        uart_model_timer_tick();
+    }
+
+    uart_model_run_interrupts();
+}
+
+/*******************************************************************************
+* Function Name: uart_model_timer_tick
+********************************************************************************
+* Summary:
+* Ends a period of the coalescing timer slice (CCU40_CC42): if it runs with
+* the period match event enabled, service request 0 is pended.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void uart_model_timer_tick(void)
+{
+    if (uart_model_ccu40.prescaler_running && uart_model_ccu40_cc42.running &&
+        uart_model_ccu40_cc42.event_enabled)
+    {
+        NVIC_SetPendingIRQ(CCU40_0_IRQn);
+    }
+}
+
+/*******************************************************************************
+* Function Name: uart_model_timer_period_us
+********************************************************************************
+* Summary:
+* Returns the period programmed into the coalescing timer slice.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: Period in microseconds, 0 if the timer does not run
+*
+*******************************************************************************/
+uint32_t uart_model_timer_period_us(void)
+{
+    if (!uart_model_ccu40_cc42.running)
+    {
+        return 0U;
+    }
+    return (uint32_t)((((uint64_t)uart_model_ccu40_cc42.period + 1U) << uart_model_ccu40_cc42.prescaler) *
+                      1000000U / XMC_SCU_CLOCK_GetCcuClockFrequency());
+}
+
+/*******************************************************************************
+* Function Name: uart_model_rx_limit
+********************************************************************************
+* Summary:
+* Returns the RX FIFO limit programmed by the driver.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: RX FIFO limit
+*
+*******************************************************************************/
+uint32_t uart_model_rx_limit(void)
+{
+    return rx_fifo.limit;
+}
+
+/*******************************************************************************
+* Function Name: uart_model_rx_level
+********************************************************************************
+* Summary:
+* Returns the RX FIFO level without accounting a register access.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: RX FIFO level
+*
+*******************************************************************************/
+uint32_t uart_model_rx_level(void)
+{
+    return rx_fifo.level;
+}
+
+/*******************************************************************************
+* Function Name: uart_model_outr
+********************************************************************************
+* Summary:
+* Reads OUTR, which removes the oldest RX FIFO entry.
+*
+* Parameters:
+*  channel: USIC channel
+*
+* Return:
+*  uint32_t: Received data
+*
+*******************************************************************************/
+uint32_t uart_model_outr(XMC_USIC_CH_t *channel)
+{
+    (void)channel;
+
+    uart_model_access();
+    if (rx_fifo.level == 0U)
+    {
+        uart_model_violation("OUTR read from an empty RX FIFO");
+        return 0U;
+    }
+
+    uart_model_stats.outr_reads++;
+    entry_reads++;
+    return uart_model_pop(&rx_fifo);
+}
+
+/* USIC channel functions of the model */
+
+bool XMC_USIC_CH_TXFIFO_IsFull(XMC_USIC_CH_t *channel)
+{
+    (void)channel;
+    uart_model_access();
+    return tx_fifo.level >= tx_fifo.size;
+}
+
+bool XMC_USIC_CH_TXFIFO_IsEmpty(XMC_USIC_CH_t *channel)
+{
+    (void)channel;
+    uart_model_access();
+    return tx_fifo.level == 0U;
+}
+
+uint32_t XMC_USIC_CH_TXFIFO_GetLevel(XMC_USIC_CH_t *channel)
+{
+    (void)channel;
+    uart_model_access();
+    return tx_fifo.level;
+}
+
+void XMC_USIC_CH_TXFIFO_EnableEvent(XMC_USIC_CH_t *channel, uint32_t event)
+{
+    (void)channel;
+    (void)event;
+    uart_model_access();
+    tx_event_enabled = true;
+}
+
+void XMC_USIC_CH_TXFIFO_DisableEvent(XMC_USIC_CH_t *channel, uint32_t event)
+{
+    (void)channel;
+    (void)event;
+    uart_model_access();
+    tx_event_enabled = false;
+}
+
+uint32_t XMC_USIC_CH_TXFIFO_GetEvent(XMC_USIC_CH_t *channel)
+{
+    (void)channel;
+    uart_model_access();
+    return tx_event;
+}
+
+void XMC_USIC_CH_TXFIFO_ClearEvent(XMC_USIC_CH_t *channel, uint32_t event)
+{
+    (void)channel;
+    uart_model_access();
+    tx_event &= ~event;
+}
+
+void XMC_USIC_CH_TXFIFO_Flush(XMC_USIC_CH_t *channel)
+{
+    (void)channel;
+    uart_model_access();
+    tx_fifo.level = 0U;
+}
+
+void XMC_USIC_CH_TXFIFO_SetSizeTriggerLimit(XMC_USIC_CH_t *channel, XMC_USIC_CH_FIFO_SIZE_t size,
+                                            uint32_t limit)
+{
+    (void)channel;
+    uart_model_access();
+    tx_fifo.size = uart_model_size(size);
+    tx_fifo.limit = limit;
+}
+
+void XMC_USIC_CH_TXFIFO_Configure(XMC_USIC_CH_t *channel, uint32_t pointer, XMC_USIC_CH_FIFO_SIZE_t size,
+                                  uint32_t limit)
+{
+    (void)channel;
+    (void)pointer;
+    uart_model_access();
+    tx_fifo.size = uart_model_size(size);
+    tx_fifo.limit = limit;
+    tx_fifo.level = 0U;
+}
+
+bool XMC_USIC_CH_RXFIFO_IsEmpty(XMC_USIC_CH_t *channel)
+{
+    (void)channel;
+    uart_model_level_read();
+    return rx_fifo.level == 0U;
+}
+
+uint32_t XMC_USIC_CH_RXFIFO_GetLevel(XMC_USIC_CH_t *channel)
+{
+    (void)channel;
+    uart_model_level_read();
+    return rx_fifo.level;
+}
+
+uint32_t XMC_USIC_CH_RXFIFO_GetEvent(XMC_USIC_CH_t *channel)
+{
+    (void)channel;
+    uart_model_access();
+    return rx_event;
+}
+
+void XMC_USIC_CH_RXFIFO_ClearEvent(XMC_USIC_CH_t *channel, uint32_t event)
+{
+    (void)channel;
+    uart_model_access();
+    rx_event &= ~event;
+}
+
+void XMC_USIC_CH_RXFIFO_Flush(XMC_USIC_CH_t *channel)
+{
+    (void)channel;
+    uart_model_access();
+    rx_fifo.level = 0U;
+}
+
+void XMC_USIC_CH_RXFIFO_SetSizeTriggerLimit(XMC_USIC_CH_t *channel, XMC_USIC_CH_FIFO_SIZE_t size,
+                                            uint32_t limit)
+{
+    (void)channel;
+    uart_model_access();
+    uart_model_arrive();
+    rx_fifo.size = uart_model_size(size);
+    rx_fifo.limit = limit;
+}
+
+void XMC_USIC_CH_RXFIFO_Configure(XMC_USIC_CH_t *channel, uint32_t pointer, XMC_USIC_CH_FIFO_SIZE_t size,
+                                  uint32_t limit)
+{
+    (void)channel;
+    (void)pointer;
+    uart_model_access();
+    rx_fifo.size = uart_model_size(size);
+    rx_fifo.limit = limit;
+    rx_fifo.level = 0U;
+}
+
+void XMC_USIC_CH_RXFIFO_SetInterruptNodePointer(XMC_USIC_CH_t *channel,
+                                                XMC_USIC_CH_RXFIFO_INTERRUPT_NODE_POINTER_t node,
+                                                uint32_t service_request)
+{
+    (void)channel;
+    uart_model_access();
+    if (node == XMC_USIC_CH_RXFIFO_INTERRUPT_NODE_POINTER_STANDARD)
+    {
+        rx_service_request = service_request;
+    }
+}
+
+void XMC_UART_CH_Transmit(XMC_USIC_CH_t *channel, uint16_t data)
+{
+    (void)channel;
+    uart_model_access();
+    if (tx_fifo.level >= tx_fifo.size)
+    {
+        uart_model_violation("write to a full TX FIFO");
+        return;
+    }
+
+    uart_model_stats.tx_writes++;
+    entry_writes++;
+    uart_model_push(&tx_fifo, (uint8_t)data);
+}
+
+uint32_t XMC_UART_CH_GetStatusFlag(XMC_USIC_CH_t *channel)
+{
+    /* The line sends the TX FIFO entries without a shift register stage */
+    (void)channel;
+    uart_model_access();
+    return (tx_fifo.level != 0U) ? (uint32_t)XMC_UART_CH_STATUS_FLAG_TRANSFER_STATUS_BUSY : 0U;
+}
+
+uint16_t XMC_UART_CH_GetReceivedData(XMC_USIC_CH_t *channel)
+{
+    /* XMCLib reads RBCTR to choose between RBUF and OUTR */
+    uart_model_access();
+    return (uint16_t)uart_model_outr(channel);
+}
+
+/* Core functions of the model */
+
+void NVIC_SetPriority(IRQn_Type irq, uint32_t priority)
+{
+    irq_priority[uart_model_irq(irq)] = priority;
+}
+
+void NVIC_EnableIRQ(IRQn_Type irq)
+{
+    irq_enabled[uart_model_irq(irq)] = true;
+}
+
+void NVIC_DisableIRQ(IRQn_Type irq)
+{
+    irq_enabled[uart_model_irq(irq)] = false;
+}
+
+void NVIC_SetPendingIRQ(IRQn_Type irq)
+{
+    irq_pending[uart_model_irq(irq)] = true;
+}
+
+void NVIC_ClearPendingIRQ(IRQn_Type irq)
+{
+    irq_pending[uart_model_irq(irq)] = false;
+}
+
+uint32_t NVIC_GetPendingIRQ(IRQn_Type irq)
+{
+    return irq_pending[uart_model_irq(irq)] ? 1U : 0U;
+}
+
+uint32_t SysTick_Config(uint32_t ticks)
+{
+    if ((ticks == 0U) || ((ticks - 1U) > SysTick_LOAD_RELOAD_Msk))
+    {
+        return 1U;
+    }
+
+    uart_model_systick.LOAD = ticks - 1U;
+    uart_model_systick.VAL = 0U;
+    uart_model_systick.CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+    return 0U;
+}
+
+uint32_t XMC_SCU_CLOCK_GetFastPeripheralClockFrequency(void)
+{
+    return SystemCoreClock;
+}
+
+uint32_t XMC_SCU_CLOCK_GetCcuClockFrequency(void)
+{
+    return SystemCoreClock;
+}
+
+void XMC_CCU4_EnableModule(XMC_CCU4_MODULE_t *module)
+{
+    uart_model_access();
+    module->enabled = true;
+}
+
+void XMC_CCU4_StartPrescaler(XMC_CCU4_MODULE_t *module)
+{
+    uart_model_access();
+    if (!module->enabled)
+    {
+        uart_model_violation("CCU4 prescaler started before the module is enabled");
+    }
+    module->prescaler_running = true;
+}
+
+void XMC_CCU4_EnableShadowTransfer(XMC_CCU4_MODULE_t *module, uint32_t shadow)
+{
+    (void)module;
+    (void)shadow;
+    uart_model_access();
+}
+
+void XMC_CCU4_EnableClock(XMC_CCU4_MODULE_t *module, uint8_t slice_number)
+{
+    (void)module;
+    (void)slice_number;
+    uart_model_access();
+}
+
+void XMC_CCU4_SLICE_CompareInit(XMC_CCU4_SLICE_t *slice, const XMC_CCU4_SLICE_COMPARE_CONFIG_t *config)
+{
+    uart_model_access();
+    slice->prescaler = config->prescaler_initval;
+}
+
+void XMC_CCU4_SLICE_SetTimerPeriodMatch(XMC_CCU4_SLICE_t *slice, uint16_t period)
+{
+    uart_model_access();
+    slice->period = period;
+}
+
+void XMC_CCU4_SLICE_SetInterruptNode(XMC_CCU4_SLICE_t *slice, XMC_CCU4_SLICE_IRQ_ID_t event,
+                                     XMC_CCU4_SLICE_SR_ID_t service_request)
+{
+    (void)slice;
+    (void)event;
+    (void)service_request;
+    uart_model_access();
+}
+
+void XMC_CCU4_SLICE_EnableEvent(XMC_CCU4_SLICE_t *slice, XMC_CCU4_SLICE_IRQ_ID_t event)
+{
+    (void)event;
+    uart_model_access();
+    slice->event_enabled = true;
+}
+
+void XMC_CCU4_SLICE_ClearEvent(XMC_CCU4_SLICE_t *slice, XMC_CCU4_SLICE_IRQ_ID_t event)
+{
+    (void)slice;
+    (void)event;
+    uart_model_access();
+}
+
+void XMC_CCU4_SLICE_StartTimer(XMC_CCU4_SLICE_t *slice)
+{
+    uart_model_access();
+    slice->running = true;
+}
+
+void XMC_CCU4_SLICE_StopTimer(XMC_CCU4_SLICE_t *slice)
+{
+    uart_model_access();
+    slice->running = false;
+}
+
+void XMC_CCU4_SLICE_ClearTimer(XMC_CCU4_SLICE_t *slice)
+{
+    (void)slice;
+    uart_model_access();
+}
+
+uint32_t __get_PRIMASK(void)
+{
+    return primask;
+}
+
+void __set_PRIMASK(uint32_t value)
+{
+    primask = value;
+}
+
+void __disable_irq(void)
+{
+    primask = 1U;
+}
+
+void __enable_irq(void)
+{
+    primask = 0U;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,107 @@
+/******************************************************************************
+* File Name:   uart_model.h
+*
+* Description: Host model of the USIC channel FIFOs and the NVIC for the
+*              UART FIFO driver. Bytes written to the TX FIFO pass over
+*              the line into the RX FIFO (internal loopback); FIFO events
+*              follow the filling level transitions of the limit.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#ifndef UART_MODEL_H_
+#define UART_MODEL_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "xmc_common.h"
+#include "xmc_uart.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+/* Largest FIFO of a USIC channel */
+#define UART_MODEL_FIFO_MAX             64U
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+/* Source of the adversarial choices, returns the next control byte */
+typedef uint8_t (*uart_model_control_t)(void);
+
+/* Line error, returns the byte as received for the byte sent */
+typedef uint8_t (*uart_model_corrupt_t)(uint8_t data);
+
+typedef struct
+{
+    uint32_t accesses;          /* Peripheral register accesses */
+    uint32_t outr_reads;        /* RX FIFO entries read through OUTR */
+    uint32_t level_reads;       /* RX FIFO level and empty checks */
+    uint32_t tx_writes;         /* TX FIFO entries written */
+    uint32_t entries;           /* Interrupt handler entries */
+    uint32_t entry_reads_max;   /* Most OUTR reads of one handler entry */
+    uint32_t entry_writes_max;  /* Most TX FIFO writes of one handler entry */
+    uint32_t overflows;         /* Bytes lost on a full RX FIFO */
+    uint32_t violations;        /* Driver accesses the hardware would not allow */
+} uart_model_stats_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+extern uart_model_stats_t uart_model_stats;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void uart_model_reset(uart_model_control_t control);
+void uart_model_line(uint32_t bytes);
+void uart_model_inject(uint8_t data);
+void uart_model_flush(void);
+void uart_model_run_interrupts(void);
+void uart_model_set_line(uint32_t byte_cycles, uart_model_corrupt_t corrupt);
+void uart_model_timer_tick(void);
+uint32_t uart_model_timer_period_us(void);
+uint32_t uart_model_rx_limit(void);
+uint32_t uart_model_rx_level(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* UART_MODEL_H_ */
+
+/* [] END OF FILE */
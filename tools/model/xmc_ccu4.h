@@ -0,0 +1,141 @@
+/******************************************************************************
+* File Name:   xmc_ccu4.h
+*
+* Description: Host model of the CCU4 timer functions used by the UART
+*              coalescing timer, simulated by uart_model.c.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#ifndef XMC_CCU4_H
+#define XMC_CCU4_H
+
+#include "xmc_common.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+#define CCU40                           (&uart_model_ccu40)
+#define CCU40_CC42                      (&uart_model_ccu40_cc42)
+#define CCU40_CC43                      (&uart_model_ccu40_cc43)
+
+#define XMC_CCU4_SHADOW_TRANSFER_SLICE_2    (1UL << 8)
+#define XMC_CCU4_SHADOW_TRANSFER_SLICE_3    (1UL << 12)
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+typedef struct
+{
+    bool enabled;
+    bool prescaler_running;
+} XMC_CCU4_MODULE_t;
+
+typedef struct
+{
+    uint32_t prescaler;
+    uint32_t period;
+    bool event_enabled;
+    bool running;
+} XMC_CCU4_SLICE_t;
+
+typedef enum
+{
+    XMC_CCU4_SLICE_TIMER_COUNT_MODE_EA = 0U
+} XMC_CCU4_SLICE_TIMER_COUNT_MODE_t;
+
+typedef enum
+{
+    XMC_CCU4_SLICE_PRESCALER_MODE_NORMAL = 0U
+} XMC_CCU4_SLICE_PRESCALER_MODE_t;
+
+typedef enum
+{
+    XMC_CCU4_SLICE_OUTPUT_PASSIVE_LEVEL_LOW = 0U
+} XMC_CCU4_SLICE_OUTPUT_PASSIVE_LEVEL_t;
+
+typedef enum
+{
+    XMC_CCU4_SLICE_IRQ_ID_PERIOD_MATCH = 0U
+} XMC_CCU4_SLICE_IRQ_ID_t;
+
+typedef enum
+{
+    XMC_CCU4_SLICE_SR_ID_0 = 0U
+} XMC_CCU4_SLICE_SR_ID_t;
+
+typedef struct
+{
+    uint32_t timer_mode : 1;
+    uint32_t monoshot : 1;
+    uint32_t prescaler_mode : 1;
+    uint32_t prescaler_initval : 4;
+    uint32_t passive_level : 1;
+    uint32_t timer_concatenation : 1;
+} XMC_CCU4_SLICE_COMPARE_CONFIG_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+extern XMC_CCU4_MODULE_t uart_model_ccu40;
+extern XMC_CCU4_SLICE_t uart_model_ccu40_cc42;
+extern XMC_CCU4_SLICE_t uart_model_ccu40_cc43;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void XMC_CCU4_EnableModule(XMC_CCU4_MODULE_t *module);
+void XMC_CCU4_StartPrescaler(XMC_CCU4_MODULE_t *module);
+void XMC_CCU4_EnableShadowTransfer(XMC_CCU4_MODULE_t *module, uint32_t shadow);
+void XMC_CCU4_EnableClock(XMC_CCU4_MODULE_t *module, uint8_t slice_number);
+void XMC_CCU4_SLICE_CompareInit(XMC_CCU4_SLICE_t *slice, const XMC_CCU4_SLICE_COMPARE_CONFIG_t *config);
+void XMC_CCU4_SLICE_SetTimerPeriodMatch(XMC_CCU4_SLICE_t *slice, uint16_t period);
+void XMC_CCU4_SLICE_SetInterruptNode(XMC_CCU4_SLICE_t *slice, XMC_CCU4_SLICE_IRQ_ID_t event,
+                                     XMC_CCU4_SLICE_SR_ID_t service_request);
+void XMC_CCU4_SLICE_EnableEvent(XMC_CCU4_SLICE_t *slice, XMC_CCU4_SLICE_IRQ_ID_t event);
+void XMC_CCU4_SLICE_ClearEvent(XMC_CCU4_SLICE_t *slice, XMC_CCU4_SLICE_IRQ_ID_t event);
+void XMC_CCU4_SLICE_StartTimer(XMC_CCU4_SLICE_t *slice);
+void XMC_CCU4_SLICE_StopTimer(XMC_CCU4_SLICE_t *slice);
+void XMC_CCU4_SLICE_ClearTimer(XMC_CCU4_SLICE_t *slice);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* XMC_CCU4_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,145 @@
+/******************************************************************************
+* File Name:   xmc_common.h
+*
+* Description: Host model of the XMC core definitions used by the UART
+*              FIFO driver: interrupt numbers, NVIC, PRIMASK and the cycle
+*              counter, simulated by uart_model.c.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#ifndef XMC_COMMON_H
+#define XMC_COMMON_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+#define XMC1                            1
+#define XMC4                            4
+
+/* The model has a DWT cycle counter like XMC4 */
+#ifndef UC_FAMILY
+#define UC_FAMILY                       XMC4
+#endif
+
+#define __NVIC_PRIO_BITS                6U
+
+#define SCB_ICSR_PENDSVSET_Msk          (1UL << 28U)
+#define SysTick_CTRL_ENABLE_Msk         (1UL << 0U)
+#define SysTick_CTRL_TICKINT_Msk        (1UL << 1U)
+#define SysTick_CTRL_CLKSOURCE_Msk      (1UL << 2U)
+#define SysTick_LOAD_RELOAD_Msk         0xFFFFFFUL
+#define CoreDebug_DEMCR_TRCENA_Msk      (1UL << 24U)
+#define DWT_CTRL_CYCCNTENA_Msk          (1UL << 0U)
+
+#define SysTick                         (&uart_model_systick)
+#define SCB                             (&uart_model_scb)
+#define DWT                             (&uart_model_dwt)
+#define CoreDebug                       (&uart_model_core_debug)
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+typedef enum
+{
+    PendSV_IRQn = -2,
+    SysTick_IRQn = -1,
+    USIC0_0_IRQn = 9,
+    USIC0_1_IRQn = 10,
+    USIC0_2_IRQn = 11,
+    USIC0_3_IRQn = 12,
+    CCU40_0_IRQn = 21
+} IRQn_Type;
+
+typedef struct
+{
+    volatile uint32_t CTRL;
+    volatile uint32_t LOAD;
+    volatile uint32_t VAL;
+} SysTick_Type;
+
+typedef struct
+{
+    volatile uint32_t ICSR;
+} SCB_Type;
+
+typedef struct
+{
+    volatile uint32_t CTRL;
+    volatile uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct
+{
+    volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+extern SysTick_Type uart_model_systick;
+extern SCB_Type uart_model_scb;
+extern DWT_Type uart_model_dwt;
+extern CoreDebug_Type uart_model_core_debug;
+extern uint32_t SystemCoreClock;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void NVIC_SetPriority(IRQn_Type irq, uint32_t priority);
+void NVIC_EnableIRQ(IRQn_Type irq);
+void NVIC_DisableIRQ(IRQn_Type irq);
+void NVIC_SetPendingIRQ(IRQn_Type irq);
+void NVIC_ClearPendingIRQ(IRQn_Type irq);
+uint32_t NVIC_GetPendingIRQ(IRQn_Type irq);
+uint32_t SysTick_Config(uint32_t ticks);
+uint32_t __get_PRIMASK(void);
+void __set_PRIMASK(uint32_t primask);
+void __disable_irq(void);
+void __enable_irq(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* XMC_COMMON_H */
+
+/* [] END OF FILE */
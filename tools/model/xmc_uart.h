@@ -0,0 +1,70 @@
+/******************************************************************************
+* File Name:   xmc_uart.h
+*
+* Description: Host model of the UART channel functions used by the UART
+*              FIFO driver, simulated by uart_model.c.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#ifndef XMC_UART_H
+#define XMC_UART_H
+
+#include "xmc_usic.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+typedef enum
+{
+    XMC_UART_CH_STATUS_FLAG_TRANSFER_STATUS_BUSY = 1U << 9U
+} XMC_UART_CH_STATUS_FLAG_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void XMC_UART_CH_Transmit(XMC_USIC_CH_t *channel, uint16_t data);
+uint16_t XMC_UART_CH_GetReceivedData(XMC_USIC_CH_t *channel);
+uint32_t XMC_UART_CH_GetStatusFlag(XMC_USIC_CH_t *channel);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* XMC_UART_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,147 @@
+/******************************************************************************
+* File Name:   xmc_usic.h
+*
+* Description: Host model of the USIC channel FIFO functions used by the
+*              UART FIFO driver, simulated by uart_model.c.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#ifndef XMC_USIC_H
+#define XMC_USIC_H
+
+#include "xmc_common.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+/* Reads of OUTR pop the RX FIFO, so the model replaces the register read */
+#define UART_RX_OUTR(channel)           uart_model_outr(channel)
+
+/* Busy-wait loops of the soak test let the line time of the model pass */
+#define UART_SOAK_POLL()                uart_model_poll()
+
+/* Frame format fields read by uart_fifo_frame_bits() */
+#define USIC_CH_SCTR_FLE_Pos            16U
+#define USIC_CH_SCTR_FLE_Msk            (0x3FUL << USIC_CH_SCTR_FLE_Pos)
+#define USIC_CH_CCR_PM_Pos              8U
+#define USIC_CH_CCR_PM_Msk              (0x3UL << USIC_CH_CCR_PM_Pos)
+#define USIC_CH_PCR_ASCMode_STPB_Msk    (1UL << 1U)
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+typedef struct
+{
+    volatile uint32_t CCR;
+    volatile uint32_t PCR_ASCMode;
+    volatile uint32_t SCTR;
+    volatile uint32_t OUTR;
+} XMC_USIC_CH_t;
+
+typedef enum
+{
+    XMC_USIC_CH_FIFO_DISABLED = 0,
+    XMC_USIC_CH_FIFO_SIZE_2WORDS,
+    XMC_USIC_CH_FIFO_SIZE_4WORDS,
+    XMC_USIC_CH_FIFO_SIZE_8WORDS,
+    XMC_USIC_CH_FIFO_SIZE_16WORDS,
+    XMC_USIC_CH_FIFO_SIZE_32WORDS,
+    XMC_USIC_CH_FIFO_SIZE_64WORDS
+} XMC_USIC_CH_FIFO_SIZE_t;
+
+typedef enum
+{
+    XMC_USIC_CH_TXFIFO_EVENT_CONF_STANDARD = 1U << 14U
+} XMC_USIC_CH_TXFIFO_EVENT_CONF_t;
+
+typedef enum
+{
+    XMC_USIC_CH_TXFIFO_EVENT_STANDARD = 1U << 0U
+} XMC_USIC_CH_TXFIFO_EVENT_t;
+
+typedef enum
+{
+    XMC_USIC_CH_RXFIFO_EVENT_STANDARD = 1U << 0U,
+    XMC_USIC_CH_RXFIFO_EVENT_ALTERNATE = 1U << 2U
+} XMC_USIC_CH_RXFIFO_EVENT_t;
+
+typedef enum
+{
+    XMC_USIC_CH_RXFIFO_INTERRUPT_NODE_POINTER_STANDARD = 8U,
+    XMC_USIC_CH_RXFIFO_INTERRUPT_NODE_POINTER_ALTERNATE = 16U
+} XMC_USIC_CH_RXFIFO_INTERRUPT_NODE_POINTER_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+uint32_t uart_model_outr(XMC_USIC_CH_t *channel);
+void uart_model_poll(void);
+
+bool XMC_USIC_CH_TXFIFO_IsFull(XMC_USIC_CH_t *channel);
+bool XMC_USIC_CH_TXFIFO_IsEmpty(XMC_USIC_CH_t *channel);
+uint32_t XMC_USIC_CH_TXFIFO_GetLevel(XMC_USIC_CH_t *channel);
+void XMC_USIC_CH_TXFIFO_EnableEvent(XMC_USIC_CH_t *channel, uint32_t event);
+void XMC_USIC_CH_TXFIFO_DisableEvent(XMC_USIC_CH_t *channel, uint32_t event);
+uint32_t XMC_USIC_CH_TXFIFO_GetEvent(XMC_USIC_CH_t *channel);
+void XMC_USIC_CH_TXFIFO_ClearEvent(XMC_USIC_CH_t *channel, uint32_t event);
+void XMC_USIC_CH_TXFIFO_Flush(XMC_USIC_CH_t *channel);
+void XMC_USIC_CH_TXFIFO_SetSizeTriggerLimit(XMC_USIC_CH_t *channel, XMC_USIC_CH_FIFO_SIZE_t size,
+                                            uint32_t limit);
+void XMC_USIC_CH_TXFIFO_Configure(XMC_USIC_CH_t *channel, uint32_t pointer, XMC_USIC_CH_FIFO_SIZE_t size,
+                                  uint32_t limit);
+
+bool XMC_USIC_CH_RXFIFO_IsEmpty(XMC_USIC_CH_t *channel);
+uint32_t XMC_USIC_CH_RXFIFO_GetLevel(XMC_USIC_CH_t *channel);
+uint32_t XMC_USIC_CH_RXFIFO_GetEvent(XMC_USIC_CH_t *channel);
+void XMC_USIC_CH_RXFIFO_ClearEvent(XMC_USIC_CH_t *channel, uint32_t event);
+void XMC_USIC_CH_RXFIFO_Flush(XMC_USIC_CH_t *channel);
+void XMC_USIC_CH_RXFIFO_SetSizeTriggerLimit(XMC_USIC_CH_t *channel, XMC_USIC_CH_FIFO_SIZE_t size,
+                                            uint32_t limit);
+void XMC_USIC_CH_RXFIFO_Configure(XMC_USIC_CH_t *channel, uint32_t pointer, XMC_USIC_CH_FIFO_SIZE_t size,
+                                  uint32_t limit);
+void XMC_USIC_CH_RXFIFO_SetInterruptNodePointer(XMC_USIC_CH_t *channel,
+                                                XMC_USIC_CH_RXFIFO_INTERRUPT_NODE_POINTER_t node,
+                                                uint32_t service_request);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* XMC_USIC_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,154 @@
+/******************************************************************************
+* File Name:   uart_baud_table.c
+*
+* Description: Host tool that prints the baud rate solver results for the
+*              peripheral clock of every supported kit.
+*              Build:  gcc -DUART_BAUD_HOST_BUILD -I.. -o uart_baud_table
+*                          uart_baud_table.c ../uart_baud.c
+*              Usage:  ./uart_baud_table [baudrate ...]
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "uart_baud.h"
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+typedef struct
+{
+    const char *kit;
+    const char *clock_source;   /* pclk_src (XMC1) or fPERIPH source (XMC4) */
+    uint32_t mclk;              /* MCLK (XMC1) or fCPU (XMC4) in Hz */
+    uint32_t periph_clock;      /* USIC clock (fPERIPH) in Hz */
+} kit_clock_t;
+
+/*******************************************************************************
+*  Global Variables
+*******************************************************************************/
+/* Clock configuration of the design.modus file of every kit */
+static const kit_clock_t kit_clocks[] =
+{
+    { "KIT_XMC11_BOOT_001",      "XMC_SCU_CLOCK_PCLKSRC_DOUBLE_MCLK",  32000000U,  32000000U },
+    { "KIT_XMC12_BOOT_001",      "XMC_SCU_CLOCK_PCLKSRC_DOUBLE_MCLK",  32000000U,  32000000U },
+    { "KIT_XMC13_BOOT_001",      "XMC_SCU_CLOCK_PCLKSRC_DOUBLE_MCLK",  32000000U,  32000000U },
+    { "KIT_XMC14_BOOT_001",      "XMC_SCU_CLOCK_PCLKSRC_DOUBLE_MCLK",  48000000U,  48000000U },
+    { "KIT_XMC_PLT2GO_XMC4200",  "fCPU / 1 (PLL 288 MHz / 4)",         72000000U,  72000000U },
+    { "KIT_XMC_PLT2GO_XMC4400",  "fCPU / 1 (PLL 288 MHz / 4)",         72000000U,  72000000U },
+    { "KIT_XMC45_RELAX_V1",      "fCPU (PLL 288 MHz / 4)",             72000000U,  72000000U },
+    { "KIT_XMC43_RELAX_ECAT_V1", "fCPU / 1 (PLL 288 MHz / 2)",        144000000U, 144000000U },
+    { "KIT_XMC47_RELAX_V1",      "fCPU / 1 (PLL 288 MHz / 2)",        144000000U, 144000000U },
+    { "KIT_XMC48_RELAX_ECAT_V1", "fCPU / 1 (PLL 288 MHz / 2)",        144000000U, 144000000U },
+};
+
+/* Baud rates printed when none are given on the command line */
+static const uint32_t default_baudrates[] =
+{
+    9600U, 115200U, 1000000U, 2000000U, 3000000U, 4000000U, 6000000U
+};
+
+#define ARRAY_SIZE(a)   (sizeof(a) / sizeof((a)[0]))
+
+/*******************************************************************************
+* Function Name: print_kit
+********************************************************************************
+* Summary:
+* Prints the solver result of every baud rate for one kit.
+*
+* Parameters:
+*  kit:       Kit clock configuration
+*  baudrates: Requested baud rates
+*  count:     Number of baud rates
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void print_kit(const kit_clock_t *kit, const uint32_t *baudrates, size_t count)
+{
+    printf("%s: %s, MCLK %lu Hz, fPERIPH %lu Hz\n", kit->kit, kit->clock_source,
+           (unsigned long)kit->mclk, (unsigned long)kit->periph_clock);
+    printf("  %10s %10s %10s %4s %5s %5s %s\n",
+           "request", "achieved", "error_ppm", "os", "pdiv", "step", "mode");
+
+    for (size_t i = 0; i < count; i++)
+    {
+        uart_baud_config_t config;
+
+        if (uart_baud_solve(kit->periph_clock, baudrates[i], &config) != UART_BAUD_STATUS_OK)
+        {
+            printf("  %10lu  out of range\n", (unsigned long)baudrates[i]);
+            continue;
+        }
+
+        printf("  %10lu %10lu %10ld %4u %5u %5u %s\n",
+               (unsigned long)baudrates[i], (unsigned long)config.baudrate,
+               (long)config.error_ppm, config.oversampling, config.pdiv, config.step,
+               config.fractional ? "fractional" : "normal");
+    }
+    printf("\n");
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t *baudrates = NULL;
+    const uint32_t *table = default_baudrates;
+    size_t count = ARRAY_SIZE(default_baudrates);
+
+    if (argc > 1)
+    {
+        baudrates = malloc((size_t)(argc - 1) * sizeof(uint32_t));
+        if (baudrates == NULL)
+        {
+            return 1;
+        }
+        for (int i = 1; i < argc; i++)
+        {
+            baudrates[i - 1] = (uint32_t)strtoul(argv[i], NULL, 0);
+        }
+        table = baudrates;
+        count = (size_t)(argc - 1);
+    }
+
+    for (size_t i = 0; i < ARRAY_SIZE(kit_clocks); i++)
+    {
+        print_kit(&kit_clocks[i], table, count);
+    }
+
+    free(baudrates);
+    return 0;
+}
+
+/* [] END OF FILE */
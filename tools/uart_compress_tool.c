@@ -0,0 +1,199 @@
+/******************************************************************************
+* File Name:   uart_compress_tool.c
+*
+* Description: Host tool for the compressed TX stream. Compresses a file in
+*              blocks as uart_compress_tx_async() does, decompresses a
+*              captured stream, or reports the compression ratio and the
+*              effective throughput at a baud rate.
+*              Build:  gcc -DUART_COMPRESS_HOST_BUILD -I.. -o uart_compress_tool
+*                          uart_compress_tool.c ../uart_compress.c
+*              Usage:  ./uart_compress_tool -c in out | -d in out | -r baudrate in
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "uart_compress.h"
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+/* Bits per UART frame: start bit, 8 data bits, stop bit */
+#define FRAME_BITS      10U
+
+/*******************************************************************************
+*  Global Variables
+*******************************************************************************/
+static uart_compress_t compress;
+static uart_decompress_t decompress;
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* Runs one of the modes:
+*  -c: compress in to out in blocks of UART_COMPRESS_BLOCK_SIZE bytes
+*  -d: decompress the stream in to out
+*  -r: compress in, decompress it again, check the round trip and report the
+*      ratio and the effective throughput at the baud rate
+*
+* Parameters:
+*  argc: Argument count
+*  argv: Arguments
+*
+* Return:
+*  int
+*
+*******************************************************************************/
+int main(int argc, char *argv[])
+{
+    uint8_t data[UART_COMPRESS_BLOCK_SIZE];
+    uint8_t block[UART_COMPRESS_BOUND(UART_COMPRESS_BLOCK_SIZE)];
+    uint8_t output[UART_COMPRESS_BLOCK_SIZE];
+    unsigned long long raw = 0U;
+    unsigned long long sent = 0U;
+    unsigned long long mismatches = 0U;
+    unsigned long baudrate = 0UL;
+    const char *mode = (argc == 4) ? argv[1] : "";
+    FILE *in;
+    FILE *out = NULL;
+    size_t length;
+
+    if (strcmp(mode, "-r") == 0)
+    {
+        baudrate = strtoul(argv[2], NULL, 0);
+    }
+    if (((strcmp(mode, "-c") != 0) && (strcmp(mode, "-d") != 0) && (strcmp(mode, "-r") != 0)) ||
+        ((strcmp(mode, "-r") == 0) && (baudrate == 0UL)))
+    {
+        fprintf(stderr, "usage: %s -c in out | -d in out | -r baudrate in\n", argv[0]);
+        return 1;
+    }
+
+    in = fopen((baudrate != 0UL) ? argv[3] : argv[2], "rb");
+    if (in == NULL)
+    {
+        perror((baudrate != 0UL) ? argv[3] : argv[2]);
+        return 1;
+    }
+    if (baudrate == 0UL)
+    {
+        out = fopen(argv[3], "wb");
+        if (out == NULL)
+        {
+            perror(argv[3]);
+            fclose(in);
+            return 1;
+        }
+    }
+
+    uart_compress_init(&compress);
+    uart_decompress_init(&decompress);
+
+    if (strcmp(mode, "-d") == 0)
+    {
+        while ((length = fread(block, 1U, sizeof(block), in)) != 0U)
+        {
+            uint32_t offset = 0U;
+
+            while (offset < length)
+            {
+                uint32_t consumed;
+                uint32_t produced = uart_decompress(&decompress, &block[offset], (uint32_t)(length - offset),
+                                                    &consumed, output, sizeof(output));
+
+                fwrite(output, 1U, produced, out);
+                offset += consumed;
+            }
+        }
+    }
+    else
+    {
+        while ((length = fread(data, 1U, sizeof(data), in)) != 0U)
+        {
+            uint32_t size = uart_compress_block(&compress, data, (uint32_t)length, block);
+
+            raw += length;
+            sent += size;
+            if (out != NULL)
+            {
+                fwrite(block, 1U, size, out);
+            }
+
+            if (baudrate != 0UL)
+            {
+                /* Feed the block in pieces of 7 bytes like RX FIFO drains */
+                uint32_t offset = 0U;
+                uint32_t total = 0U;
+
+                while (offset < size)
+                {
+                    uint32_t piece = ((size - offset) < 7U) ? (size - offset) : 7U;
+                    uint32_t consumed;
+                    uint32_t produced = uart_decompress(&decompress, &block[offset], piece, &consumed,
+                                                        &output[total], (uint32_t)(sizeof(output) - total));
+
+                    total += produced;
+                    offset += consumed;
+                }
+                if ((total != length) || (memcmp(output, data, length) != 0))
+                {
+                    mismatches++;
+                }
+            }
+        }
+
+        if (baudrate != 0UL)
+        {
+            double ratio = (sent != 0U) ? ((double)raw / (double)sent) : 0.0;
+
+            printf("%llu bytes -> %llu bytes, ratio %.2f, window %u, block %u\n", raw, sent, ratio,
+                   UART_COMPRESS_WINDOW, UART_COMPRESS_BLOCK_SIZE);
+            printf("effective throughput at %lu baud: %.0f bytes/s (uncompressed %.0f bytes/s)\n",
+                   baudrate, ratio * (double)baudrate / FRAME_BITS, (double)baudrate / FRAME_BITS);
+            printf("round trip: %s\n", (mismatches == 0U) ? "ok" : "MISMATCH");
+        }
+    }
+
+    fclose(in);
+    if (out != NULL)
+    {
+        fclose(out);
+    }
+
+    return (mismatches == 0U) ? 0 : 1;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,556 @@
+/******************************************************************************
+* File Name:   uart_drain_model.c
+*
+* Description: Host model run of the UART FIFO driver against adversarial
+*              FIFO level sequences. The real uart_fifo.c transfers frames
+*              through the model of tools/model: line progress, interrupt
+*              latency and the bytes arriving at every RX FIFO level read
+*              of the drain come from a control source. Every transfer is
+*              checked for lost, duplicated or reordered data, writes
+*              beyond the read buffer, stalls, and handler entries moving
+*              more than UART_ISR_MAX_BYTES.
+*              Build:  make -C tools drain_model
+*              Usage:  ./uart_drain_model [-s seed] [-n transfers] [-f]
+*              -f keeps the FIFO limits fixed; built with
+*              UART_COALESCE_LATENCY_US, the limits and the fallback timer
+*              of coalescing are used.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "uart_model.h"
+#include "uart_config.h"
+#include "cybsp.h"
+#include "uart_fifo.h"
+#include "uart_drain_model.h"
+#if (UART_COALESCE_LATENCY_US != 0U)
+#include "uart_coalesce.h"
+#endif
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+/* Longest frame of a transfer */
+#define UART_DRAIN_MODEL_MAX_LENGTH     64U
+
+/* Most bytes a read may exceed its frame by, left to the coalescing timer */
+#define UART_DRAIN_MODEL_TAIL           8U
+
+/* Guard bytes behind the read buffer */
+#define UART_DRAIN_MODEL_GUARD          8U
+#define UART_DRAIN_MODEL_GUARD_BYTE     0xA5U
+
+/* Line steps the interrupts may be held off in a row */
+#define UART_DRAIN_MODEL_LATENCY        2U
+
+/* Line steps per byte before a transfer counts as stalled */
+#define UART_DRAIN_MODEL_STEPS          8U
+
+#ifndef UART_DRAIN_MODEL_TRANSFERS
+#define UART_DRAIN_MODEL_TRANSFERS      10000U
+#endif
+
+/* Baud rate the coalescing limits and timer period are computed for */
+#ifndef UART_DRAIN_MODEL_BAUDRATE
+#define UART_DRAIN_MODEL_BAUDRATE       115200U
+#endif
+
+/* Average bytes per line step, 1 to 3 */
+#define UART_DRAIN_MODEL_STEP_BYTES     2U
+
+/*******************************************************************************
+*  Global Variables
+*******************************************************************************/
+/* Control source: a byte string (fuzzing) or else a pseudo-random sequence */
+static const uint8_t *control_data;
+static size_t control_size;
+static size_t control_index;
+static uint32_t control_state;
+
+static uint8_t tx_data[UART_DRAIN_MODEL_MAX_LENGTH];
+static uint8_t rx_data[UART_DRAIN_MODEL_MAX_LENGTH + UART_DRAIN_MODEL_TAIL + UART_DRAIN_MODEL_GUARD];
+static uint32_t tx_done_count;
+static uint32_t rx_done_count;
+#if (UART_STATS_CMD_ENABLE == 1)
+static uint32_t command_count;
+#endif
+
+/* Line steps per period of the coalescing timer, 0 = no timer */
+static uint32_t timer_steps;
+static uint32_t timer_step;
+
+uart_drain_model_result_t uart_drain_model_result;
+bool uart_drain_model_fixed_limits;
+
+/*******************************************************************************
+* Function Name: uart_drain_model_control
+********************************************************************************
+* Summary:
+* Returns the next control byte. A byte string ends in zeros, the
+* pseudo-random sequence is xorshift32.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint8_t: Control byte
+*
+*******************************************************************************/
+static uint8_t uart_drain_model_control(void)
+{
+    if (control_data != NULL)
+    {
+        return (control_index < control_size) ? control_data[control_index++] : 0U;
+    }
+
+    control_state ^= control_state << 13;
+    control_state ^= control_state >> 17;
+    control_state ^= control_state << 5;
+    return (uint8_t)(control_state >> 24);
+}
+
+/*******************************************************************************
+* Function Name: uart_drain_model_fail
+********************************************************************************
+* Summary:
+* Reports a failed transfer.
+*
+* Parameters:
+*  what:   Description
+*  length: Frame length
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void uart_drain_model_fail(const char *what, uint32_t length)
+{
+    uint32_t tx_limit;
+    uint32_t rx_limit;
+
+    uart_fifo_get_limits(&tx_limit, &rx_limit);
+    fprintf(stderr, "uart_drain_model: transfer %u of %u bytes: %s (received %u, limits %u/%u, "
+            "RX FIFO level %u, limit %u)\n",
+            uart_drain_model_result.transfers, length, what, uart_fifo_rx_count(), tx_limit, rx_limit,
+            uart_model_rx_level(), uart_model_rx_limit());
+    uart_drain_model_result.failures++;
+}
+
+static void uart_drain_model_tx_done(void)
+{
+    tx_done_count++;
+}
+
+static void uart_drain_model_rx_done(void)
+{
+    rx_done_count++;
+}
+
+/*******************************************************************************
+* Function Name: uart_drain_model_recover
+********************************************************************************
+* Summary:
+* Aborts the transfer and empties the FIFOs, so a failed or lost transfer does
+* not spill into the next one.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void uart_drain_model_recover(void)
+{
+    (void)uart_fifo_write_abort();
+    (void)uart_fifo_read_abort();
+    uart_model_flush();
+}
+
+#if (UART_STATS_CMD_ENABLE == 1)
+static void uart_drain_model_command(void)
+{
+    command_count++;
+}
+
+/*******************************************************************************
+* Function Name: uart_drain_model_command_idle
+********************************************************************************
+* Summary:
+* Sends the stats command from the peer while no read is active and checks
+* that the drain serves it.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void uart_drain_model_command_idle(void)
+{
+    uint32_t commands = command_count;
+    uint32_t overflows = uart_model_stats.overflows;
+
+    uart_model_inject(UART_STATS_CMD_BYTE);
+    if ((uart_drain_model_control() & 1U) != 0U)
+    {
+        uart_model_run_interrupts();
+    }
+    uart_model_inject(UART_STATS_CMD_REQUEST);
+    uart_model_run_interrupts();
+
+    if ((command_count != (commands + 1U)) && (overflows == uart_model_stats.overflows))
+    {
+        uart_drain_model_fail("stats command without a read not served", 0U);
+    }
+}
+#endif
+
+/*******************************************************************************
+* Function Name: uart_drain_model_transfer
+********************************************************************************
+* Summary:
+* Writes a frame through the loopback and reads it back. A transfer that lost
+* bytes to an RX FIFO overflow, forced by the interrupt latency, is aborted
+* and counted; any other incomplete or wrong transfer is a failure. With the
+* coalescing timer, some reads are longer than the frame: the tail below the
+* RX FIFO limit must be drained by the timer within two periods after the
+* line went idle.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void uart_drain_model_transfer(void)
+{
+    uint32_t length = 1U + (((uint32_t)uart_drain_model_control() << 8 | uart_drain_model_control()) %
+                            UART_DRAIN_MODEL_MAX_LENGTH);
+    uint32_t overflows = uart_model_stats.overflows;
+    uint32_t tail = 0U;
+    uint32_t tail_steps = 0U;
+    uint32_t held = 0U;
+    uint32_t steps = 0U;
+    uint32_t failures;
+    bool done = false;
+    bool lost;
+
+    for (uint32_t i = 0U; i < length; i++)
+    {
+        /* Frequent 0xF5 exercises the escape of the stats command */
+        tx_data[i] = ((uart_drain_model_control() & 3U) == 0U) ? 0xF5U : uart_drain_model_control();
+    }
+    memset(rx_data, UART_DRAIN_MODEL_GUARD_BYTE, sizeof(rx_data));
+
+    if (!uart_drain_model_fixed_limits && ((uart_drain_model_control() & 7U) == 0U))
+    {
+        uint32_t tx_limit = uart_drain_model_control() % UART_FIFO_SIZE;
+
+        uart_fifo_set_limits(tx_limit, uart_drain_model_control() % UART_FIFO_SIZE);
+    }
+    if ((timer_steps != 0U) && ((uart_drain_model_control() & 3U) == 0U))
+    {
+        tail = 1U + (uart_drain_model_control() % UART_DRAIN_MODEL_TAIL);
+    }
+
+    tx_done_count = 0U;
+    rx_done_count = 0U;
+    uart_drain_model_result.transfers++;
+    uart_drain_model_result.bytes += length;
+    if (!uart_fifo_read(rx_data, length + tail) || !uart_fifo_write(tx_data, length))
+    {
+        uart_drain_model_fail("transfer not started", length);
+        uart_drain_model_recover();
+        return;
+    }
+    uart_model_run_interrupts();
+
+    /* The TX FIFO empties within its size in line steps after the write
+     * completed, then the timer has two periods and the interrupt latency
+     */
+    while (!done && (steps < ((UART_DRAIN_MODEL_STEPS * length) + UART_DRAIN_MODEL_MAX_LENGTH)) &&
+           (tail_steps <= (UART_FIFO_SIZE + (2U * timer_steps) + UART_DRAIN_MODEL_LATENCY)))
+    {
+        uart_model_line(1U + (uart_drain_model_control() % 3U));
+        if ((timer_steps != 0U) && (++timer_step >= timer_steps))
+        {
+            timer_step = 0U;
+            uart_model_timer_tick();
+        }
+        if ((held < UART_DRAIN_MODEL_LATENCY) && ((uart_drain_model_control() & 1U) != 0U))
+        {
+            held++;
+        }
+        else
+        {
+            held = 0U;
+            uart_model_run_interrupts();
+        }
+        steps++;
+        if ((tail != 0U) && (tx_done_count != 0U))
+        {
+            tail_steps++;
+        }
+        done = (tx_done_count != 0U) &&
+               ((tail == 0U) ? (rx_done_count != 0U) : (uart_fifo_rx_count() >= length));
+    }
+
+    lost = (overflows != uart_model_stats.overflows);
+    failures = uart_drain_model_result.failures;
+    if (!done)
+    {
+        if (!lost)
+        {
+            uart_drain_model_fail((tx_done_count == 0U) ? "write stalled" :
+                                  ((tail == 0U) ? "read stalled" : "tail not drained within two timer periods"),
+                                  length);
+        }
+    }
+    else if ((tx_done_count != 1U) || (rx_done_count != ((tail == 0U) ? 1U : 0U)))
+    {
+        uart_drain_model_fail("completion called more than once or too early", length);
+    }
+    else if (!lost && (memcmp(tx_data, rx_data, length) != 0))
+    {
+        uart_drain_model_fail("data differs", length);
+    }
+
+    for (uint32_t i = length + tail; i < sizeof(rx_data); i++)
+    {
+        if (rx_data[i] != UART_DRAIN_MODEL_GUARD_BYTE)
+        {
+            uart_drain_model_fail("read wrote beyond its buffer", length);
+            break;
+        }
+    }
+
+    if (tail != 0U)
+    {
+        (void)uart_fifo_read_abort();
+    }
+    if (lost)
+    {
+        uart_drain_model_result.lost++;
+    }
+    if (lost || (failures != uart_drain_model_result.failures))
+    {
+        uart_drain_model_recover();
+    }
+}
+
+#if (UART_COALESCE_LATENCY_US != 0U)
+/*******************************************************************************
+* Function Name: uart_drain_model_coalesce
+********************************************************************************
+* Summary:
+* Sets the FIFO limits that coalescing selects for UART_COALESCE_LATENCY_US at
+* UART_DRAIN_MODEL_BAUDRATE and starts the fallback timer, like main.c. The
+* timer ticks after the line steps of its period. The limits are kept fixed.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: 1 if the timer did not start, else 0
+*
+*******************************************************************************/
+static uint32_t uart_drain_model_coalesce(void)
+{
+    uart_coalesce_config_t config;
+    uint32_t byte_time_ns = (uint32_t)((uart_fifo_frame_bits() * 1000000000ULL) / UART_DRAIN_MODEL_BAUDRATE);
+
+    uart_coalesce_compute(UART_DRAIN_MODEL_BAUDRATE, uart_fifo_frame_bits(), UART_COALESCE_LATENCY_US,
+                          UART_FIFO_SIZE, &config);
+    uart_fifo_set_limits(config.tx_limit, config.rx_limit);
+    uart_drain_model_fixed_limits = true;
+    timer_steps = 0U;
+    timer_step = 0U;
+
+    if (config.timer_period_us != 0U)
+    {
+        if (!uart_fifo_start_timer(config.timer_period_us))
+        {
+            fprintf(stderr, "uart_drain_model: timer period of %u us not started\n", config.timer_period_us);
+            return 1U;
+        }
+        timer_steps = (uint32_t)(((uint64_t)uart_model_timer_period_us() * 1000U) /
+                                 (UART_DRAIN_MODEL_STEP_BYTES * byte_time_ns));
+        if (timer_steps == 0U)
+        {
+            timer_steps = 1U;
+        }
+    }
+    return 0U;
+}
+#endif
+
+/*******************************************************************************
+* Function Name: uart_drain_model_run
+********************************************************************************
+* Summary:
+* Resets the model and the driver and runs transfers with the given control
+* source.
+*
+* Parameters:
+*  data:      Control bytes, NULL for the pseudo-random sequence
+*  size:      Number of control bytes
+*  seed:      Seed of the pseudo-random sequence, not 0
+*  transfers: Number of transfers
+*
+* Return:
+*  uint32_t: Failed transfers and model violations
+*
+*******************************************************************************/
+uint32_t uart_drain_model_run(const uint8_t *data, size_t size, uint32_t seed, uint32_t transfers)
+{
+    control_data = data;
+    control_size = size;
+    control_index = 0U;
+    control_state = (seed != 0U) ? seed : 1U;
+
+    uart_model_reset(uart_drain_model_control);
+    (void)uart_fifo_write_abort();
+    (void)uart_fifo_read_abort();
+    uart_fifo_init();
+    uart_fifo_register_callbacks(uart_drain_model_tx_done, uart_drain_model_rx_done);
+#if (UART_STATS_CMD_ENABLE == 1)
+    uart_fifo_register_command(uart_drain_model_command);
+#endif
+#if (UART_COALESCE_LATENCY_US != 0U)
+    if (uart_drain_model_coalesce() != 0U)
+    {
+        return 1U;
+    }
+#else
+    uart_fifo_set_limits(CYBSP_DEBUG_UART_TXFIFO_LIMIT, CYBSP_DEBUG_UART_RXFIFO_LIMIT);
+#endif
+    memset(&uart_stats, 0, sizeof(uart_stats));
+    memset(&uart_drain_model_result, 0, sizeof(uart_drain_model_result));
+
+    for (uint32_t i = 0U; i < transfers; i++)
+    {
+        uart_drain_model_transfer();
+#if (UART_STATS_CMD_ENABLE == 1)
+        if ((uart_drain_model_control() & 3U) == 0U)
+        {
+            uart_drain_model_command_idle();
+        }
+#endif
+        if ((data != NULL) && (control_index >= size))
+        {
+            break;
+        }
+    }
+
+    return uart_drain_model_result.failures + uart_model_stats.violations;
+}
+
+#if !defined(UART_DRAIN_MODEL_NO_MAIN)
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* Runs the pseudo-random transfers and prints the counters of the driver and
+* the model. Cycles are register accesses in the model.
+*
+* Parameters:
+*  argc: Argument count
+*  argv: Arguments
+*
+* Return:
+*  int: 0 if all transfers passed
+*
+*******************************************************************************/
+int main(int argc, char *argv[])
+{
+    uint32_t seed = 1U;
+    uint32_t transfers = UART_DRAIN_MODEL_TRANSFERS;
+    uint32_t failures;
+    uint32_t bytes;
+    uint32_t tx_limit;
+    uint32_t rx_limit;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "-s") == 0) && ((i + 1) < argc))
+        {
+            seed = (uint32_t)strtoul(argv[++i], NULL, 0);
+        }
+        else if ((strcmp(argv[i], "-n") == 0) && ((i + 1) < argc))
+        {
+            transfers = (uint32_t)strtoul(argv[++i], NULL, 0);
+        }
+        else if (strcmp(argv[i], "-f") == 0)
+        {
+            uart_drain_model_fixed_limits = true;
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [-s seed] [-n transfers] [-f]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    failures = uart_drain_model_run(NULL, 0U, seed, transfers);
+    bytes = uart_stats.tx_bytes + uart_stats.rx_bytes;
+    uart_fifo_get_limits(&tx_limit, &rx_limit);
+
+    printf("UART drain model, UART_ISR_MAX_BYTES=%u, UART_COALESCE_LATENCY_US=%u, seed %u\n",
+           (unsigned)UART_ISR_MAX_BYTES, (unsigned)UART_COALESCE_LATENCY_US, seed);
+    printf("  limits TX / RX       %10u / %u\n", tx_limit, rx_limit);
+    printf("  transfers            %10u  (%u bytes, %u lost to RX FIFO overflow)\n",
+           uart_drain_model_result.transfers, uart_drain_model_result.bytes, uart_drain_model_result.lost);
+    printf("  TX / RX interrupts   %10u / %u\n", uart_stats.tx_irq_count, uart_stats.rx_irq_count);
+    printf("  interrupts per kbyte %10u\n", uart_stats_irq_per_kbyte(&uart_stats));
+    printf("  timer drains         %10u\n", uart_stats.timer_irq_count);
+    printf("  OUTR reads per entry %10u  max\n", uart_model_stats.entry_reads_max);
+    printf("  TX writes per entry  %10u  max\n", uart_model_stats.entry_writes_max);
+    printf("  level reads per kbyte %9u\n",
+           (bytes == 0U) ? 0U : (uint32_t)(((uint64_t)uart_model_stats.level_reads * 1000U) / bytes));
+    printf("  isr_cycles           %10u  (register accesses, %u per kbyte, %u max per entry)\n",
+           uart_stats.isr_cycles,
+           (bytes == 0U) ? 0U : (uint32_t)(((uint64_t)uart_stats.isr_cycles * 1000U) / bytes),
+           uart_stats.isr_cycles_max);
+    printf("  failures             %10u  (%u model violations)\n", failures, uart_model_stats.violations);
+
+    return (failures == 0U) ? 0 : 1;
+}
+#endif
+
+/* [] END OF FILE */
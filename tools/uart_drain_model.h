@@ -0,0 +1,79 @@
+/******************************************************************************
+* File Name:   uart_drain_model.h
+*
+* Description: Interface of the UART drain model run, shared by the model
+*              program and the fuzz target.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#ifndef UART_DRAIN_MODEL_H_
+#define UART_DRAIN_MODEL_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+typedef struct
+{
+    uint32_t transfers;         /* Transfers run */
+    uint32_t bytes;             /* Payload bytes of the transfers */
+    uint32_t lost;              /* Transfers aborted after an RX FIFO overflow */
+    uint32_t failures;          /* Transfers with lost, wrong or late data */
+} uart_drain_model_result_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+extern uart_drain_model_result_t uart_drain_model_result;
+extern bool uart_drain_model_fixed_limits;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+uint32_t uart_drain_model_run(const uint8_t *data, size_t size, uint32_t seed, uint32_t transfers);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* UART_DRAIN_MODEL_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,170 @@
+#!/bin/bash
+################################################################################
+# File Name:   uart_footprint.sh
+#
+# Description: Prints the flash and RAM used by the UART driver modules
+#              (uart_*.o) from the linker map file and checks them against a
+#              budget. Only sections kept by the linker and allocated on
+#              the target are counted: .text, .rodata, .ARM.exidx,
+#              .ARM.extab and .data in flash, .bss, .noinit, COMMON and
+#              .data in RAM.
+#              Usage:  uart_footprint.sh <map file> [ram budget] [flash budget]
+#              A budget of 0 is not checked. Exits with 1 if a budget is
+#              exceeded, or if a budget is set and the map file is missing.
+#
+# Related Document: See README.md
+#
+################################################################################
+#
+# Copyright (c) 2015-2021, Infineon Technologies AG
+# All rights reserved.
+#
+# Boost Software License - Version 1.0 - August 17th, 2003
+#
+# Permission is hereby granted, free of charge, to any person or organization
+# obtaining a copy of the software and accompanying documentation covered by
+# this license (the "Software") to use, reproduce, display, distribute,
+# execute, and transmit the Software, and to prepare derivative works of the
+# Software, and to permit third-parties to whom the Software is furnished to
+# do so, all subject to the following:
+#
+# The copyright notices in the Software and this entire statement, including
+# the above license grant, this restriction and the following disclaimer,
+# must be included in all copies of the Software, in whole or in part, and
+# all derivative works of the Software, unless such copies or derivative
+# works are solely in the form of machine-executable object code generated by
+# a source language processor.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+# SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+# FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+# DEALINGS IN THE SOFTWARE.
+#
+################################################################################
+
+map="$1"
+ram_budget="${2:-0}"
+flash_budget="${3:-0}"
+
+if [ -z "$map" ]; then
+    echo "usage: $0 <map file> [ram budget] [flash budget]" >&2
+    exit 2
+fi
+
+# A missing map file only breaks the build if a budget must be checked,
+# e.g. with a toolchain that writes no map
+if [ ! -f "$map" ]; then
+    if [ "$ram_budget" != "0" ] || [ "$flash_budget" != "0" ]; then
+        echo "uart_footprint: $map not found, cannot check the budget" >&2
+        exit 1
+    fi
+    echo "uart_footprint: $map not found, no footprint report" >&2
+    exit 0
+fi
+
+awk -v ram_budget="$ram_budget" -v flash_budget="$flash_budget" -v map="$map" '
+# Hexadecimal number of the map file, in plain POSIX awk
+function hex(text,    value, i)
+{
+    value = 0
+    text = tolower(text)
+    sub(/^0x/, "", text)
+    for (i = 1; i <= length(text); i++)
+    {
+        value = (value * 16) + index("0123456789abcdef", substr(text, i, 1)) - 1
+    }
+    return value
+}
+
+# Input section of a driver object: account its size by section type. Only
+# sections allocated on the target count; debug info, .comment, attributes
+# and the host unwind tables are not loaded.
+function account(section, size, file,    module, in_flash, in_ram)
+{
+    if (file !~ /(^|[\/\\])uart_[A-Za-z0-9_]+\.o$/)
+    {
+        return
+    }
+    in_flash = (section ~ /^\.(text|rodata|data|ARM\.exidx|ARM\.extab)/)
+    in_ram = (section ~ /^\.(bss|noinit|data)/) || (section == "COMMON")
+    if (!in_flash && !in_ram)
+    {
+        return
+    }
+    size = hex(size)
+    if (size == 0)
+    {
+        return
+    }
+    module = file
+    sub(/^.*[\/\\]/, "", module)
+    if (!(module in ram))
+    {
+        names[++count] = module
+        ram[module] = 0
+        flash[module] = 0
+    }
+
+    if (in_ram)
+    {
+        ram[module] += size
+    }
+    if (in_flash)
+    {
+        flash[module] += size
+    }
+}
+
+# Discarded input sections are listed before the memory map
+/^Linker script and memory map/ { in_map = 1; next }
+!in_map { next }
+
+# Section name and address, size and file on the next line
+pending != "" {
+    if (($1 ~ /^0x/) && (NF >= 3))
+    {
+        account(pending, $2, $3)
+    }
+    pending = ""
+    next
+}
+
+/^ [.A-Za-z_]/ {
+    if ((NF >= 4) && ($2 ~ /^0x/) && ($3 ~ /^0x/))
+    {
+        account($1, $3, $4)
+    }
+    else if (NF == 1)
+    {
+        pending = $1
+    }
+}
+
+END {
+    printf "UART driver footprint (bytes), %s\n", map
+    printf "  %-24s %8s %8s\n", "module", "flash", "ram"
+    for (i = 1; i <= count; i++)
+    {
+        printf "  %-24s %8d %8d\n", names[i], flash[names[i]], ram[names[i]]
+        flash_total += flash[names[i]]
+        ram_total += ram[names[i]]
+    }
+    printf "  %-24s %8d %8d\n", "total", flash_total, ram_total
+
+    status = 0
+    if ((ram_budget > 0) && (ram_total > ram_budget))
+    {
+        printf "uart_footprint: RAM %d exceeds the budget of %d bytes\n", ram_total, ram_budget > "/dev/stderr"
+        status = 1
+    }
+    if ((flash_budget > 0) && (flash_total > flash_budget))
+    {
+        printf "uart_footprint: flash %d exceeds the budget of %d bytes\n", flash_total, flash_budget > "/dev/stderr"
+        status = 1
+    }
+    exit status
+}
+' "$map"
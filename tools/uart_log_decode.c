@@ -0,0 +1,356 @@
+/******************************************************************************
+* File Name:   uart_log_decode.c
+*
+* Description: Host tool that decodes the binary frames of the deferred log
+*              (UART_LOG_BINARY) from a serial capture or a live stream into
+*              text lines, using the formats of uart_log_formats.h.
+*              Build:  gcc -DUART_LOG_HOST_BUILD -I.. -o uart_log_decode
+*                          uart_log_decode.c
+*              With UART_LOG_DECODE_NO_MAIN the decoder is linked into the
+*              fuzz target instead.
+*              Usage:  ./uart_log_decode [-c clock_hz] [-p period] [-e] log.bin | -
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "uart_log_decode.h"
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+#define UART_LOG_FORMAT(id, format)     format,
+
+/*******************************************************************************
+*  Global Variables
+*******************************************************************************/
+static const char *const formats[UART_LOG_FORMAT_COUNT] =
+{
+    UART_LOG_FORMATS(UART_LOG_FORMAT)
+};
+
+/*******************************************************************************
+* Function Name: get_u32
+********************************************************************************
+* Summary:
+* Reads a 32-bit little endian value.
+*
+* Parameters:
+*  data: First byte
+*
+* Return:
+*  uint32_t
+*
+*******************************************************************************/
+static uint32_t get_u32(const uint8_t *data)
+{
+    return (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+/*******************************************************************************
+* Function Name: frame_length
+********************************************************************************
+* Summary:
+* Checks the start of the window for a complete, valid frame.
+*
+* Parameters:
+*  window: Received bytes
+*  count:  Number of received bytes
+*
+* Return:
+*  size_t: Frame length, 0 if more bytes are needed, SIZE_MAX if the window
+*          does not start with a valid frame
+*
+*******************************************************************************/
+static size_t frame_length(const uint8_t *window, size_t count)
+{
+    size_t length;
+    uint8_t sum = 0U;
+
+    if (window[0] != UART_LOG_FRAME_SYNC)
+    {
+        return SIZE_MAX;
+    }
+    if (count < 3U)
+    {
+        return 0U;
+    }
+    if ((window[1] >= UART_LOG_FORMAT_COUNT) || (window[2] > UART_LOG_MAX_ARGS))
+    {
+        return SIZE_MAX;
+    }
+
+    length = UART_LOG_FRAME_HEADER + (4U * window[2]) + 1U;
+    if (count < length)
+    {
+        return 0U;
+    }
+    for (size_t i = 0; i < length; i++)
+    {
+        sum += window[i];
+    }
+
+    return (sum == 0U) ? length : SIZE_MAX;
+}
+
+/*******************************************************************************
+* Function Name: print_frame
+********************************************************************************
+* Summary:
+* Prints a frame as text line with the time since the previous frame, in
+* microseconds if the clock is known, else in counter ticks.
+*
+* Parameters:
+*  decoder: Decoder state
+*  frame:   Valid frame
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void print_frame(uart_log_decoder_t *decoder, const uint8_t *frame)
+{
+    uint32_t timestamp = get_u32(&frame[3]);
+    uint32_t args[UART_LOG_MAX_ARGS] = { 0U };
+    uint32_t prev = decoder->prev;
+    uint32_t period = decoder->period;
+    uint64_t ticks = 0U;
+
+    for (uint32_t i = 0U; i < frame[2]; i++)
+    {
+        args[i] = get_u32(&frame[UART_LOG_FRAME_HEADER + (4U * i)]);
+    }
+
+    if (!decoder->first)
+    {
+        /* Down counter reloading from period - 1 */
+        ticks = (period == 0U) ? (uint32_t)(timestamp - prev) :
+                ((prev >= timestamp) ? (prev - timestamp) : ((uint64_t)prev + period - timestamp));
+    }
+    decoder->first = false;
+    decoder->prev = timestamp;
+
+    if (decoder->clock_hz != 0U)
+    {
+        fprintf(decoder->out, "+%10.1f us  ", (double)ticks * 1e6 / decoder->clock_hz);
+    }
+    else
+    {
+        fprintf(decoder->out, "+%10llu     ", (unsigned long long)ticks);
+    }
+    fprintf(decoder->out, formats[frame[1]], (unsigned int)args[0], (unsigned int)args[1], (unsigned int)args[2]);
+    fprintf(decoder->out, "\n");
+    fflush(decoder->out);
+}
+
+/*******************************************************************************
+* Function Name: uart_log_decoder_init
+********************************************************************************
+* Summary:
+* Starts decoding a new stream.
+*
+* Parameters:
+*  decoder:  Decoder state
+*  clock_hz: Timestamp frequency, 0 if unknown
+*  period:   0: 32-bit up counter, else down counter period
+*  unescape: Undo the doubling of UART_STATS_CMD_BYTE of a stats command build
+*  out:      Stream of the text lines
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void uart_log_decoder_init(uart_log_decoder_t *decoder, uint32_t clock_hz, uint32_t period, bool unescape,
+                           FILE *out)
+{
+    memset(decoder, 0, sizeof(*decoder));
+    decoder->clock_hz = clock_hz;
+    decoder->period = period;
+    decoder->unescape = unescape;
+    decoder->first = true;
+    decoder->out = out;
+}
+
+/*******************************************************************************
+* Function Name: uart_log_decode_byte
+********************************************************************************
+* Summary:
+* Decodes the stream byte by byte. Bytes not forming a valid frame are skipped
+* and counted, so the decoder resynchronizes after a corrupted frame. With
+* unescape, the doubling of UART_STATS_CMD_BYTE is undone and other escape
+* sequences are dropped first.
+*
+* Parameters:
+*  decoder: Decoder state
+*  byte:    Received byte
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void uart_log_decode_byte(uart_log_decoder_t *decoder, uint8_t byte)
+{
+    if (decoder->unescape)
+    {
+        /* A doubled escape is one data byte, any other pair is dropped */
+        if (!decoder->escaped && (byte == UART_STATS_CMD_BYTE))
+        {
+            decoder->escaped = true;
+            return;
+        }
+        if (decoder->escaped)
+        {
+            decoder->escaped = false;
+            if (byte != UART_STATS_CMD_BYTE)
+            {
+                return;
+            }
+        }
+    }
+
+    decoder->window[decoder->count++] = byte;
+
+    /* Drop leading bytes until the window starts with a frame or its
+     * beginning
+     */
+    for (;;)
+    {
+        size_t length = frame_length(decoder->window, decoder->count);
+
+        if (length == 0U)
+        {
+            break;
+        }
+        if (length != SIZE_MAX)
+        {
+            print_frame(decoder, decoder->window);
+        }
+        else
+        {
+            decoder->skipped++;
+            length = 1U;
+        }
+        decoder->count -= length;
+        memmove(decoder->window, &decoder->window[length], decoder->count);
+        if (decoder->count == 0U)
+        {
+            break;
+        }
+    }
+}
+
+#if !defined(UART_LOG_DECODE_NO_MAIN)
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* Decodes a capture file or stdin, see uart_log_decode_byte().
+*
+* Parameters:
+*  argc: Argument count
+*  argv: Arguments
+*
+* Return:
+*  int
+*
+*******************************************************************************/
+int main(int argc, char *argv[])
+{
+    static uart_log_decoder_t decoder;
+    uint32_t clock_hz = 0U;
+    uint32_t period = 0U;
+    const char *path = NULL;
+    bool unescape = false;
+    FILE *file;
+    int byte;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "-c") == 0) && ((i + 1) < argc))
+        {
+            clock_hz = (uint32_t)strtoul(argv[++i], NULL, 0);
+        }
+        else if ((strcmp(argv[i], "-p") == 0) && ((i + 1) < argc))
+        {
+            period = (uint32_t)strtoul(argv[++i], NULL, 0);
+        }
+        else if (strcmp(argv[i], "-e") == 0)
+        {
+            unescape = true;
+        }
+        else if (path == NULL)
+        {
+            path = argv[i];
+        }
+        else
+        {
+            path = NULL;
+            break;
+        }
+    }
+    if (path == NULL)
+    {
+        fprintf(stderr, "usage: %s [-c clock_hz] [-p period] [-e] log.bin | -\n", argv[0]);
+        return 1;
+    }
+
+    file = (strcmp(path, "-") == 0) ? stdin : fopen(path, "rb");
+    if (file == NULL)
+    {
+        perror(path);
+        return 1;
+    }
+
+    uart_log_decoder_init(&decoder, clock_hz, period, unescape, stdout);
+    while ((byte = fgetc(file)) != EOF)
+    {
+        uart_log_decode_byte(&decoder, (uint8_t)byte);
+    }
+
+    if (file != stdin)
+    {
+        fclose(file);
+    }
+    if (decoder.skipped != 0UL)
+    {
+        fprintf(stderr, "%lu bytes skipped\n", decoder.skipped);
+    }
+
+    return 0;
+}
+#endif
+
+/* [] END OF FILE */
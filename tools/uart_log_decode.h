@@ -0,0 +1,84 @@
+/******************************************************************************
+* File Name:   uart_log_decode.h
+*
+* Description: Interface of the deferred log decoder, shared by
+*              uart_log_decode and the fuzz target.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+
+#ifndef UART_LOG_DECODE_H_
+#define UART_LOG_DECODE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include "uart_log.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+typedef struct
+{
+    uint8_t window[UART_LOG_FRAME_MAX]; /* Bytes of the frame being received */
+    size_t count;                       /* Bytes in the window */
+    unsigned long skipped;              /* Bytes not forming a valid frame */
+    uint32_t clock_hz;                  /* Timestamp frequency, 0 if unknown */
+    uint32_t period;                    /* 0: up counter, else down counter period */
+    uint32_t prev;                      /* Timestamp of the previous frame */
+    bool first;                         /* No frame decoded yet */
+    bool unescape;                      /* Undo the stats command escapes */
+    bool escaped;                       /* Escape byte received */
+    FILE *out;                          /* Stream of the text lines */
+} uart_log_decoder_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void uart_log_decoder_init(uart_log_decoder_t *decoder, uint32_t clock_hz, uint32_t period, bool unescape,
+                           FILE *out);
+void uart_log_decode_byte(uart_log_decoder_t *decoder, uint8_t byte);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* UART_LOG_DECODE_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,230 @@
+/******************************************************************************
+* File Name:   uart_soak_model.c
+*
+* Description: Host model run of the soak test. The real uart_soak.c and
+*              uart_fifo.c run in loopback against the FIFO model of tools/model;
+*              the busy-wait loops of the soak test let the line time pass. Over
+*              the fixed UART_SOAK_SEED sequence, the run reports the bit-error
+*              rate, the throughput and the worst latency, and fails on lost
+*              frames, model violations, or bit errors other than the injected
+*              ones.
+*              Build:  make -C tools soak_model
+*              Usage:  ./uart_soak_model [-n iterations] [-e bit errors per 10^6]
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "uart_model.h"
+#include "uart_config.h"
+#include "cybsp.h"
+#include "cycfg_peripherals.h"
+#include "uart_fifo.h"
+#include "uart_cycles.h"
+#include "uart_soak.h"
+#if (UART_COALESCE_LATENCY_US != 0U)
+#include "uart_coalesce.h"
+#endif
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+/* Baud rate of the modeled line */
+#ifndef UART_SOAK_MODEL_BAUDRATE
+#define UART_SOAK_MODEL_BAUDRATE        115200U
+#endif
+
+#ifndef UART_SOAK_MODEL_ITERATIONS
+#define UART_SOAK_MODEL_ITERATIONS      100000U
+#endif
+
+/* Seed of the line errors, independent of the soak sequence */
+#define UART_SOAK_MODEL_ERROR_SEED      0x6D2B79F5U
+
+/*******************************************************************************
+*  Global Variables
+*******************************************************************************/
+static uint32_t error_rate;
+static uint32_t error_state = UART_SOAK_MODEL_ERROR_SEED;
+static uint64_t errors_injected;
+
+/*******************************************************************************
+* Function Name: uart_soak_model_corrupt
+********************************************************************************
+* Summary:
+* Line error: flips each bit of the byte with a probability of error_rate
+* per million, from an xorshift32 sequence.
+*
+* Parameters:
+*  data: Byte sent
+*
+* Return:
+*  uint8_t: Byte received
+*
+*******************************************************************************/
+static uint8_t uart_soak_model_corrupt(uint8_t data)
+{
+    for (uint32_t bit = 0U; bit < 8U; bit++)
+    {
+        error_state ^= error_state << 13;
+        error_state ^= error_state >> 17;
+        error_state ^= error_state << 5;
+        if ((error_state % 1000000U) < error_rate)
+        {
+            data ^= (uint8_t)(1U << bit);
+            errors_injected++;
+        }
+    }
+    return data;
+}
+
+/*******************************************************************************
+* Function Name: uart_soak_model_limits
+********************************************************************************
+* Summary:
+* Sets the FIFO limits like main.c: from design.modus, or with coalescing the
+* computed limits and the fallback timer.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void uart_soak_model_limits(void)
+{
+#if (UART_COALESCE_LATENCY_US != 0U)
+    uart_coalesce_config_t config;
+
+    uart_coalesce_compute(uart_fifo_baudrate(), uart_fifo_frame_bits(), UART_COALESCE_LATENCY_US,
+                          UART_RX_FIFO_SIZE, &config);
+    uart_fifo_set_limits(config.tx_limit, config.rx_limit);
+    if ((config.timer_period_us != 0U) && !uart_fifo_start_timer(config.timer_period_us))
+    {
+        uart_fifo_set_limits(config.tx_limit, 0U);
+    }
+#else
+    uart_fifo_set_limits(CYBSP_DEBUG_UART_TXFIFO_LIMIT, CYBSP_DEBUG_UART_RXFIFO_LIMIT);
+#endif
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* Runs the soak iterations and prints the results of uart_soak_stats.
+*
+* Parameters:
+*  argc: Argument count
+*  argv: Arguments
+*
+* Return:
+*  int: 0 if the run passed
+*
+*******************************************************************************/
+int main(int argc, char *argv[])
+{
+    uint32_t iterations = UART_SOAK_MODEL_ITERATIONS;
+    uint32_t failed = 0U;
+    double ber;
+    double run_s;
+    int status = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "-n") == 0) && ((i + 1) < argc))
+        {
+            iterations = (uint32_t)strtoul(argv[++i], NULL, 0);
+        }
+        else if ((strcmp(argv[i], "-e") == 0) && ((i + 1) < argc))
+        {
+            error_rate = (uint32_t)strtoul(argv[++i], NULL, 0);
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [-n iterations] [-e bit errors per 10^6]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    uart_model_reset(NULL);
+    uart_cycles_init();
+    uart_fifo_init();
+    uart_fifo_set_baudrate(UART_SOAK_MODEL_BAUDRATE);
+    uart_soak_model_limits();
+    uart_model_set_line((SystemCoreClock / uart_fifo_baudrate()) * uart_fifo_frame_bits(),
+                        (error_rate != 0U) ? uart_soak_model_corrupt : NULL);
+    uart_soak_init();
+
+    for (uint32_t i = 0U; i < iterations; i++)
+    {
+        if (!uart_soak_iteration())
+        {
+            failed++;
+        }
+    }
+
+    ber = (uart_soak_stats.bytes == 0U) ? 0.0 :
+          ((double)uart_soak_stats.bit_errors / (8.0 * (double)uart_soak_stats.bytes));
+    run_s = (double)uart_soak_stats.cycles / (double)SystemCoreClock;
+
+    printf("UART soak model, %u baud, UART_SOAK_MAX_LENGTH=%u, seed 0x%08X\n",
+           (unsigned)UART_SOAK_MODEL_BAUDRATE, (unsigned)UART_SOAK_MAX_LENGTH, (unsigned)UART_SOAK_SEED);
+    printf("  iterations           %10u  (%u failed, %u lost)\n", uart_soak_stats.iterations, failed,
+           uart_soak_stats.frames_lost);
+    printf("  bytes                %10llu  (%.1f s of line time)\n", (unsigned long long)uart_soak_stats.bytes,
+           run_s);
+    printf("  bit errors           %10llu  (BER %.3g, %llu injected)\n",
+           (unsigned long long)uart_soak_stats.bit_errors, ber, (unsigned long long)errors_injected);
+    printf("  throughput           %10u  bit/s\n", uart_soak_stats.throughput_bps);
+    printf("  worst latency        %10u  cycles (%.0f us)\n", uart_soak_stats.latency_max,
+           (double)uart_soak_stats.latency_max * 1e6 / (double)SystemCoreClock);
+    printf("  model violations     %10u\n", uart_model_stats.violations);
+
+    /* Every received bit error must be an injected one, and without lost
+     * frames every injected error is received
+     */
+    if ((uart_soak_stats.frames_lost != 0U) || (uart_model_stats.violations != 0U) ||
+        (uart_soak_stats.bit_errors != errors_injected))
+    {
+        printf("  FAILED\n");
+        status = 1;
+    }
+
+    return status;
+}
+
+/* [] END OF FILE */
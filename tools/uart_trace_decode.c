@@ -0,0 +1,449 @@
+/******************************************************************************
+* File Name:   uart_trace_decode.c
+*
+* Description: Host tool that decodes a dump of uart_trace_buffer into a
+*              timeline, per event and per interrupt summaries, or folded
+*              stacks for flame graph tools.
+*              Build:  gcc -DUART_TRACE_HOST_BUILD -I.. -o uart_trace_decode
+*                          uart_trace_decode.c
+*              Usage:  ./uart_trace_decode [-s | -f] trace.bin
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "uart_trace.h"
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+#define ARRAY_SIZE(a)   (sizeof(a) / sizeof((a)[0]))
+
+/* Interrupt nesting supported by the folded stack output */
+#define STACK_DEPTH     4U
+
+/* Service requests of the FIFO interrupts */
+#define SERVICE_REQUESTS    2U
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+typedef enum
+{
+    OUTPUT_TIMELINE,
+    OUTPUT_SUMMARY,
+    OUTPUT_FOLDED
+} output_t;
+
+typedef struct
+{
+    uint32_t count;
+    uint64_t arg_sum;
+} event_summary_t;
+
+typedef struct
+{
+    uint32_t count;
+    uint64_t total;
+    uint64_t min;
+    uint64_t max;
+} isr_summary_t;
+
+typedef struct
+{
+    char stack[64];
+    uint64_t ticks;
+} folded_t;
+
+/*******************************************************************************
+*  Global Variables
+*******************************************************************************/
+static const char *const event_names[] =
+{
+    [UART_TRACE_ISR_BEGIN] = "isr_begin",
+    [UART_TRACE_ISR_END]   = "isr_end",
+    [UART_TRACE_TX_REFILL] = "tx_refill",
+    [UART_TRACE_RX_DRAIN]  = "rx_drain",
+    [UART_TRACE_RX_LIMIT]  = "rx_limit",
+    [UART_TRACE_TX_DONE]   = "tx_done",
+    [UART_TRACE_RX_DONE]   = "rx_done",
+    [UART_TRACE_VERIFY]    = "verify",
+    [UART_TRACE_CLOCK]     = "clock",
+};
+
+static event_summary_t event_summary[UART_TRACE_EVENT_Msk + 1U];
+static isr_summary_t isr_summary[SERVICE_REQUESTS];
+static folded_t folded[64];
+static size_t folded_count;
+
+/*******************************************************************************
+* Function Name: event_name
+********************************************************************************
+* Summary:
+* Returns the name of an event, user events are numbered.
+*
+* Parameters:
+*  event: Event (UART_TRACE_xxx)
+*
+* Return:
+*  const char *
+*
+*******************************************************************************/
+static const char *event_name(uint32_t event)
+{
+    static char name[16];
+
+    if ((event < ARRAY_SIZE(event_names)) && (event_names[event] != NULL))
+    {
+        return event_names[event];
+    }
+    snprintf(name, sizeof(name), "%s_%lu", (event >= UART_TRACE_USER) ? "user" : "unknown",
+             (unsigned long)((event >= UART_TRACE_USER) ? (event - UART_TRACE_USER) : event));
+    return name;
+}
+
+/*******************************************************************************
+* Function Name: ticks_between
+********************************************************************************
+* Summary:
+* Returns the ticks between two timestamps. Consecutive events must be less
+* than one counter period apart.
+*
+* Parameters:
+*  period: Counter period, 0 for the 32-bit up counter
+*  prev:   Earlier timestamp
+*  now:    Later timestamp
+*
+* Return:
+*  uint64_t
+*
+*******************************************************************************/
+static uint64_t ticks_between(uint32_t period, uint32_t prev, uint32_t now)
+{
+    if (period == 0U)
+    {
+        return (uint32_t)(now - prev);
+    }
+
+    /* Down counter reloading from period - 1 */
+    return (prev >= now) ? (prev - now) : ((uint64_t)prev + period - now);
+}
+
+/*******************************************************************************
+* Function Name: period_after
+********************************************************************************
+* Summary:
+* Returns the counter period of the records from record n on: the previous
+* period logged by the next UART_TRACE_CLOCK event, or the period of the
+* header if the counter was not reprogrammed since.
+*
+* Parameters:
+*  trace:   Trace buffer
+*  records: Records of the trace buffer
+*  first:   Index of the oldest record
+*  count:   Number of records
+*  n:       Record, counted from the oldest
+*
+* Return:
+*  uint32_t
+*
+*******************************************************************************/
+static uint32_t period_after(const uart_trace_buffer_t *trace, const uart_trace_record_t *records,
+                             uint32_t first, uint32_t count, uint32_t n)
+{
+    for (uint32_t i = n; i < count; i++)
+    {
+        uint32_t event = records[(first + i) & (trace->depth - 1U)].event;
+
+        if ((event & UART_TRACE_EVENT_Msk) == UART_TRACE_CLOCK)
+        {
+            return (event >> UART_TRACE_ARG_Pos) + 1U;
+        }
+    }
+    return trace->counter_period;
+}
+
+/*******************************************************************************
+* Function Name: folded_add
+********************************************************************************
+* Summary:
+* Adds ticks to a folded stack.
+*
+* Parameters:
+*  stack: Frames separated by ';'
+*  ticks: Ticks spent in the stack
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void folded_add(const char *stack, uint64_t ticks)
+{
+    size_t i;
+
+    for (i = 0; i < folded_count; i++)
+    {
+        if (strcmp(folded[i].stack, stack) == 0)
+        {
+            break;
+        }
+    }
+    if (i == folded_count)
+    {
+        if (folded_count == ARRAY_SIZE(folded))
+        {
+            return;
+        }
+        snprintf(folded[i].stack, sizeof(folded[i].stack), "%s", stack);
+        folded_count++;
+    }
+    folded[i].ticks += ticks;
+}
+
+/*******************************************************************************
+* Function Name: decode
+********************************************************************************
+* Summary:
+* Walks the records from the oldest to the newest, prints the timeline and
+* collects the summaries. The time from one event to the next is attributed
+* to the interrupt stack at the later event and to the work it logged. The
+* counter was reprogrammed before a clock event, so no time passes up to it.
+*
+* Parameters:
+*  trace:  Trace buffer
+*  output: Selected output
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void decode(const uart_trace_buffer_t *trace, output_t output)
+{
+    uint32_t count = (trace->head < trace->depth) ? trace->head : trace->depth;
+    uint32_t first = trace->head - count;
+    uint32_t stack[STACK_DEPTH];
+    uint64_t begin[STACK_DEPTH];
+    uint32_t depth = 0U;
+    uint32_t prev = 0U;
+    uint32_t period;
+    uint64_t time = 0U;
+    double us_per_tick = 1e6 / trace->clock_hz;
+    const uart_trace_record_t *records =
+        (const uart_trace_record_t *)((const uint8_t *)trace + offsetof(uart_trace_buffer_t, records));
+
+    period = period_after(trace, records, first, count, 0U);
+
+    if (output == OUTPUT_TIMELINE)
+    {
+        printf("%lu events, %lu dropped, %lu Hz\n", (unsigned long)count,
+               (unsigned long)first, (unsigned long)trace->clock_hz);
+        printf("%12s %10s  %-12s %s\n", "time_us", "delta_us", "event", "arg");
+    }
+
+    for (uint32_t n = 0U; n < count; n++)
+    {
+        const uart_trace_record_t *record = &records[(first + n) & (trace->depth - 1U)];
+        uint32_t event = record->event & UART_TRACE_EVENT_Msk;
+        uint32_t arg = record->event >> UART_TRACE_ARG_Pos;
+        uint64_t delta = ((n == 0U) || (event == UART_TRACE_CLOCK)) ? 0U :
+                         ticks_between(period, prev, record->timestamp);
+        char path[64] = "main";
+
+        if (event == UART_TRACE_CLOCK)
+        {
+            period = period_after(trace, records, first, count, n + 1U);
+        }
+        time += delta;
+        prev = record->timestamp;
+
+        for (uint32_t i = 0U; i < depth; i++)
+        {
+            size_t len = strlen(path);
+            snprintf(&path[len], sizeof(path) - len, ";usic0_%lu", (unsigned long)stack[i]);
+        }
+        if ((event != UART_TRACE_ISR_BEGIN) && (event != UART_TRACE_ISR_END))
+        {
+            size_t len = strlen(path);
+            snprintf(&path[len], sizeof(path) - len, ";%s", event_name(event));
+        }
+        folded_add(path, delta);
+
+        event_summary[event].count++;
+        event_summary[event].arg_sum += arg;
+
+        if (output == OUTPUT_TIMELINE)
+        {
+            printf("%12.2f %10.2f  %*s%-*s %lu\n", time * us_per_tick, delta * us_per_tick,
+                   (int)(2U * depth), "", (int)(12U - 2U * depth), event_name(event), (unsigned long)arg);
+        }
+
+        if ((event == UART_TRACE_ISR_BEGIN) && (depth < STACK_DEPTH))
+        {
+            stack[depth] = arg;
+            begin[depth] = time;
+            depth++;
+        }
+        else if ((event == UART_TRACE_ISR_END) && (depth > 0U))
+        {
+            depth--;
+            if (stack[depth] < SERVICE_REQUESTS)
+            {
+                isr_summary_t *isr = &isr_summary[stack[depth]];
+                uint64_t duration = time - begin[depth];
+
+                if ((isr->count == 0U) || (duration < isr->min))
+                {
+                    isr->min = duration;
+                }
+                if (duration > isr->max)
+                {
+                    isr->max = duration;
+                }
+                isr->total += duration;
+                isr->count++;
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: print_summary
+********************************************************************************
+* Summary:
+* Prints the event counts and the interrupt durations in timestamp ticks.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void print_summary(void)
+{
+    printf("%-12s %8s %10s\n", "event", "count", "arg_sum");
+    for (uint32_t event = 0U; event < ARRAY_SIZE(event_summary); event++)
+    {
+        if (event_summary[event].count != 0U)
+        {
+            printf("%-12s %8lu %10llu\n", event_name(event), (unsigned long)event_summary[event].count,
+                   (unsigned long long)event_summary[event].arg_sum);
+        }
+    }
+
+    printf("\n%-12s %8s %10s %10s %10s\n", "isr", "count", "min", "avg", "max");
+    for (uint32_t sr = 0U; sr < SERVICE_REQUESTS; sr++)
+    {
+        const isr_summary_t *isr = &isr_summary[sr];
+
+        if (isr->count != 0U)
+        {
+            printf("usic0_%-6lu %8lu %10llu %10llu %10llu\n", (unsigned long)sr, (unsigned long)isr->count,
+                   (unsigned long long)isr->min, (unsigned long long)(isr->total / isr->count),
+                   (unsigned long long)isr->max);
+        }
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    output_t output = OUTPUT_TIMELINE;
+    uart_trace_buffer_t *trace;
+    const char *path;
+    FILE *file;
+    size_t size;
+
+    if ((argc == 3) && (strcmp(argv[1], "-s") == 0))
+    {
+        output = OUTPUT_SUMMARY;
+    }
+    else if ((argc == 3) && (strcmp(argv[1], "-f") == 0))
+    {
+        output = OUTPUT_FOLDED;
+    }
+    else if (argc != 2)
+    {
+        fprintf(stderr, "usage: %s [-s | -f] trace.bin\n", argv[0]);
+        return 1;
+    }
+    path = argv[argc - 1];
+
+    file = fopen(path, "rb");
+    if (file == NULL)
+    {
+        perror(path);
+        return 1;
+    }
+
+    /* The record count of the target may differ from UART_TRACE_DEPTH */
+    trace = calloc(1U, sizeof(*trace) + (1U << 16) * sizeof(uart_trace_record_t));
+    if (trace == NULL)
+    {
+        fclose(file);
+        return 1;
+    }
+    size = fread(trace, 1U, sizeof(*trace) + (1U << 16) * sizeof(uart_trace_record_t), file);
+    fclose(file);
+
+    if ((size < offsetof(uart_trace_buffer_t, records)) || (trace->magic != UART_TRACE_MAGIC) ||
+        (trace->version != UART_TRACE_VERSION) || (trace->depth == 0U) ||
+        ((trace->depth & (trace->depth - 1U)) != 0U) || (trace->clock_hz == 0U) ||
+        (size < offsetof(uart_trace_buffer_t, records) + trace->depth * sizeof(uart_trace_record_t)))
+    {
+        fprintf(stderr, "%s: not a uart_trace_buffer dump\n", path);
+        free(trace);
+        return 1;
+    }
+
+    decode(trace, output);
+
+    if (output == OUTPUT_SUMMARY)
+    {
+        print_summary();
+    }
+    else if (output == OUTPUT_FOLDED)
+    {
+        for (size_t i = 0; i < folded_count; i++)
+        {
+            printf("%s %llu\n", folded[i].stack, (unsigned long long)folded[i].ticks);
+        }
+    }
+
+    free(trace);
+    return 0;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,418 @@
+#!/bin/bash
+################################################################################
+# File Name:   uart_wcet.sh
+#
+# Description: Static instruction count bound of the UART interrupt handlers.
+#              The handlers and the functions they call are disassembled. The
+#              loops of a function are found by their backward branches and
+#              run the trip count annotated in uart_wcet_loops.txt; an
+#              instruction inside nested loops counts the product of their
+#              trip counts. Each direct call adds the bound of the callee, an
+#              indirect call the largest bound of its annotated callees. A
+#              function with an annotated depth is followed through calls
+#              back into itself up to that depth.
+#              The handlers are the roots of uart_wcet_loops.txt.
+#              Usage:  uart_wcet.sh <elf file> [-D<name>[=<value>]...]
+#              The -D options are the DEFINES of the build. Exits with 1 if
+#              a handler reaches a loop without trip count or with 0 trips,
+#              an indirect call without callees or a recursion without
+#              depth.
+#
+# Related Document: See README.md
+#
+################################################################################
+#
+# Copyright (c) 2015-2021, Infineon Technologies AG
+# All rights reserved.
+#
+# Boost Software License - Version 1.0 - August 17th, 2003
+#
+# Permission is hereby granted, free of charge, to any person or organization
+# obtaining a copy of the software and accompanying documentation covered by
+# this license (the "Software") to use, reproduce, display, distribute,
+# execute, and transmit the Software, and to prepare derivative works of the
+# Software, and to permit third-parties to whom the Software is furnished to
+# do so, all subject to the following:
+#
+# The copyright notices in the Software and this entire statement, including
+# the above license grant, this restriction and the following disclaimer,
+# must be included in all copies of the Software, in whole or in part, and
+# all derivative works of the Software, unless such copies or derivative
+# works are solely in the form of machine-executable object code generated by
+# a source language processor.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+# SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+# FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+# DEALINGS IN THE SOFTWARE.
+#
+################################################################################
+
+elf="$1"
+objdump="${OBJDUMP:-arm-none-eabi-objdump}"
+cpp="${CPP:-arm-none-eabi-cpp}"
+tools="$(cd "$(dirname "$0")" && pwd)"
+loops="${UART_WCET_LOOPS:-$tools/uart_wcet_loops.txt}"
+
+if [ -z "$elf" ]; then
+    echo "usage: $0 <elf file> [-D<name>[=<value>]...]" >&2
+    exit 2
+fi
+shift
+
+if [ ! -f "$elf" ]; then
+    echo "uart_wcet: $elf not found" >&2
+    exit 2
+fi
+
+# Evaluate the trip counts with the configuration of the build. The C integer
+# suffixes are dropped for the shell arithmetic.
+set -o pipefail
+annotations="$(mktemp)"
+trap 'rm -f "$annotations"' EXIT
+
+$cpp -P -x c -I"$tools/.." "$@" "$loops" | while read -r kind function rest; do
+    case "$kind" in
+    loop)
+        expression="$(echo "$rest" | sed -E 's/\b(0[xX][0-9a-fA-F]+|[0-9]+)[uUlL]+\b/\1/g')"
+        if ! trips="$( (echo "$((expression))") 2>/dev/null)"; then
+            echo "uart_wcet: $function: trip count '$rest' is not a constant" >&2
+            exit 1
+        fi
+        echo "loop $function $trips"
+        ;;
+    call)
+        echo "call $function $rest"
+        ;;
+    depth)
+        echo "depth $function $rest"
+        ;;
+    root)
+        echo "root $function"
+        ;;
+    esac
+done > "$annotations" || exit 2
+
+"$objdump" -d --no-show-raw-insn "$elf" | awk -v elf="$elf" -v defines="$*" -v annotations="$annotations" '
+# Hexadecimal address, in plain POSIX awk
+function hex(text,    value, i)
+{
+    value = 0
+    text = tolower(text)
+    for (i = 1; i <= length(text); i++)
+    {
+        value = (value * 16) + index("0123456789abcdef", substr(text, i, 1)) - 1
+    }
+    return value
+}
+
+# Symbol of a branch operand "8000abc <name+0x12>"
+function target_name(operand,    name)
+{
+    if (!match(operand, /<[^>+]+/))
+    {
+        return ""
+    }
+    name = substr(operand, RSTART + 1, RLENGTH - 1)
+    return name
+}
+
+function target_address(operand)
+{
+    if (!match(operand, /[0-9a-f]+ </))
+    {
+        return -1
+    }
+    return hex(substr(operand, RSTART, RLENGTH - 2))
+}
+
+# Largest bound of the annotated targets of an indirect call, 0 if none of
+# them is linked
+function indirect_bound(f,    n, i, b, callee, largest)
+{
+    largest = 0
+    n = split(targets[f], callee, " ")
+    for (i = 1; i <= n; i++)
+    {
+        if (callee[i] in count)
+        {
+            b = bound(callee[i])
+            if (b > largest)
+            {
+                largest = b
+            }
+            if (callee[i] in unbounded)
+            {
+                unbounded[f] = 1
+            }
+        }
+    }
+    return largest
+}
+
+# Whether the calls since the last entry of f pass a function with a depth,
+# which then ends the cycle back into f
+function through_depth(f,    s)
+{
+    for (s = stack_size; (s > 0) && (stack[s] != f); s--)
+    {
+        if (stack[s] in depths)
+        {
+            return 1
+        }
+    }
+    return 0
+}
+
+# Instruction bound of a function including its callees. A call back into a
+# function being bounded ends there once the function is on the call stack
+# as often as its annotated depth; the bounds computed below such a cut
+# depend on the level and are not kept.
+function bound(f,    i, t, h, callee, total, mult, b, depth, heads, head, loop_end, cuts)
+{
+    if (f in cost)
+    {
+        return cost[f]
+    }
+    if (!(f in count))
+    {
+        unknown[f] = 1
+        return 0
+    }
+    if (f in visiting)
+    {
+        if (!(f in depths) && !through_depth(f))
+        {
+            recursive[f] = 1
+            return 0
+        }
+        if ((f in depths) && (visiting[f] >= depths[f]))
+        {
+            depth_cuts++
+            return 0
+        }
+    }
+    visiting[f]++
+    stack[++stack_size] = f
+    cuts = depth_cuts
+
+    # A backward branch inside the function closes a loop from its target;
+    # branches to the same target close the same loop
+    heads = 0
+    for (i = 1; i <= count[f]; i++)
+    {
+        if ((mn[f, i] ~ /^(b|cbn?z)/) && (mn[f, i] !~ /^(bl|blx|bx|bkpt|bic|bics)/))
+        {
+            t = target_address(op[f, i])
+            if ((t >= start[f]) && (t <= addr[f, i]))
+            {
+                if (!(t in loop_end))
+                {
+                    head[++heads] = t
+                    loop_end[t] = addr[f, i]
+                }
+                else if (addr[f, i] > loop_end[t])
+                {
+                    loop_end[t] = addr[f, i]
+                }
+            }
+        }
+    }
+    loops[f] = heads
+    if (heads > 0)
+    {
+        if (!(f in trips))
+        {
+            missing[f] = 1
+        }
+        else if (trips[f] == 0)
+        {
+            zero[f] = 1
+        }
+    }
+
+    total = 0
+    for (i = 1; i <= count[f]; i++)
+    {
+        # Product of the trip counts of the loops around the instruction
+        mult = 1
+        depth = 0
+        for (h = 1; h <= heads; h++)
+        {
+            if ((addr[f, i] >= head[h]) && (addr[f, i] <= loop_end[head[h]]))
+            {
+                mult *= (f in trips) ? trips[f] : 1
+                depth++
+            }
+        }
+        if (depth > nesting[f])
+        {
+            nesting[f] = depth
+        }
+        total += mult
+
+        callee = ""
+        if ((mn[f, i] ~ /^blx?$/) && (op[f, i] ~ /</))
+        {
+            callee = target_name(op[f, i])
+        }
+        else if ((mn[f, i] ~ /^blx$/) || ((mn[f, i] == "bx") && (op[f, i] !~ /^lr/)))
+        {
+            if (f in targets)
+            {
+                total += mult * indirect_bound(f)
+            }
+            else
+            {
+                unresolved[f] = 1
+            }
+        }
+        else if (mn[f, i] ~ /^b/)
+        {
+            # Tail call into another function
+            callee = target_name(op[f, i])
+            if (callee == f)
+            {
+                callee = ""
+            }
+        }
+        if (callee != "")
+        {
+            total += mult * bound(callee)
+            if (callee in unbounded)
+            {
+                unbounded[f] = 1
+            }
+        }
+    }
+
+    if ((f in missing) || (f in zero) || (f in unresolved))
+    {
+        unbounded[f] = 1
+    }
+    stack_size--
+    if (--visiting[f] == 0)
+    {
+        delete visiting[f]
+    }
+    if (!(f in shown))
+    {
+        reached[++reached_count] = f
+    }
+    if (total > shown[f])
+    {
+        shown[f] = total
+    }
+    if (depth_cuts == cuts)
+    {
+        cost[f] = total
+    }
+    return total
+}
+
+# Annotations: "loop <function> <trips>", "call <function> <callee>...",
+# "depth <function> <levels>" and "root <handler>"
+FILENAME == annotations {
+    if ($1 == "root")
+    {
+        roots[++root_count] = $2
+    }
+    else if ($1 == "loop")
+    {
+        trips[$2] = $3
+    }
+    else if ($1 == "call")
+    {
+        for (i = 3; i <= NF; i++)
+        {
+            targets[$2] = targets[$2] " " $i
+        }
+    }
+    else if ($1 == "depth")
+    {
+        depths[$2] = $3
+    }
+    next
+}
+
+/^[0-9a-f]+ <[^>]+>:$/ {
+    name = $2
+    gsub(/[<>:]/, "", name)
+    start[name] = hex($1)
+    count[name] = 0
+    next
+}
+
+/^ *[0-9a-f]+:\t/ {
+    if (name == "")
+    {
+        next
+    }
+    n = split($0, field, "\t")
+    mnemonic = field[2]
+    sub(/ +$/, "", mnemonic)
+    if ((mnemonic == "") || (mnemonic ~ /^\./))
+    {
+        next
+    }
+    i = ++count[name]
+    address = field[1]
+    gsub(/[ :]/, "", address)
+    addr[name, i] = hex(address)
+    mn[name, i] = mnemonic
+    op[name, i] = (n >= 3) ? field[3] : ""
+}
+
+END {
+    if (root_count == 0)
+    {
+        print "uart_wcet: no root handler annotated" > "/dev/stderr"
+        exit 2
+    }
+
+    printf "UART interrupt instruction bound, %s %s\n", elf, defines
+    printf "  %-40s %8s %6s %6s %10s\n", "function", "instr", "loops", "trips", "bound"
+    for (r = 1; r <= root_count; r++)
+    {
+        if (roots[r] in count)
+        {
+            bound(roots[r])
+        }
+    }
+    for (i = 1; i <= reached_count; i++)
+    {
+        f = reached[i]
+        printf "  %-40s %8d %6s %6s %10s%s\n", f, count[f],
+               (loops[f] > 0) ? sprintf("%d/%d", loops[f], nesting[f]) : "0",
+               (loops[f] == 0) ? "-" : ((f in trips) ? trips[f] : "?"),
+               (f in unbounded) ? "unbounded" : shown[f],
+               (f in depths) ? sprintf("  depth %d", depths[f]) : ""
+    }
+
+    status = 0
+    for (f in missing)
+    {
+        printf "uart_wcet: %s contains a loop without trip count in uart_wcet_loops.txt\n", f > "/dev/stderr"
+        status = 1
+    }
+    for (f in zero)
+    {
+        printf "uart_wcet: %s has a trip count of 0, build with UART_ISR_MAX_BYTES\n", f > "/dev/stderr"
+        status = 1
+    }
+    for (f in unresolved)
+    {
+        printf "uart_wcet: %s contains an indirect call without callees in uart_wcet_loops.txt\n", f > "/dev/stderr"
+        status = 1
+    }
+    for (f in recursive)
+    {
+        printf "uart_wcet: %s is recursive without depth in uart_wcet_loops.txt\n", f > "/dev/stderr"
+        status = 1
+    }
+    exit status
+}
+' "$annotations" -
@@ -0,0 +1,511 @@
+/******************************************************************************
+* File Name:   uart_async.c
+*
+* Description: This file contains the asynchronous transfer API on top of the
+*              UART FIFO driver. The FIFO interrupts only advance the request
+*              queues and start the next request; the completion callbacks run
+*              later from PendSV at the lowest priority, so the FIFO interrupts
+*              stay short. Not built with COMPONENTS=FREERTOS, which owns PendSV.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#if !defined(COMPONENT_FREERTOS)
+
+#include "xmc_common.h"
+#include "uart_async.h"
+#include "uart_fifo.h"
+#include "uart_cycles.h"
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+#define UART_ASYNC_QUEUE_MASK           (UART_ASYNC_QUEUE_DEPTH - 1U)
+
+/* No TX priority queue is transmitting */
+#define UART_ASYNC_TX_IDLE              UART_ASYNC_TX_PRIORITIES
+
+#if ((UART_ASYNC_QUEUE_DEPTH & UART_ASYNC_QUEUE_MASK) != 0U)
+#error "UART_ASYNC_QUEUE_DEPTH must be a power of two"
+#endif
+
+/* Critical section against the FIFO interrupts and PendSV */
+#define UART_ASYNC_ENTER_CRITICAL()     uint32_t primask = __get_PRIMASK(); __disable_irq()
+#define UART_ASYNC_EXIT_CRITICAL()      __set_PRIMASK(primask)
+
+/* Starts a queued read, with its error map if the status is captured */
+#if (UART_RX_STATUS_ENABLE == 1)
+#define UART_ASYNC_READ(request)        uart_fifo_read_status((request)->buffer, (request)->error_map, (request)->length)
+#else
+#define UART_ASYNC_READ(request)        uart_fifo_read((request)->buffer, (request)->length)
+#endif
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+typedef struct
+{
+    uint8_t *buffer;
+    uint32_t length;
+    uart_async_callback_t callback;
+    uint32_t queued;            /* Cycle counter when queued */
+#if (UART_RX_STATUS_ENABLE == 1)
+    uint32_t *error_map;        /* Parity error map of a read (can be NULL) */
+#endif
+} uart_async_request_t;
+
+/* Ring of requests with free-running indices:
+ * [done, head) completed, callback pending (advanced by PendSV)
+ * [head, tail) queued, head is the active request (advanced by the ISR)
+ */
+typedef struct
+{
+    uart_async_request_t request[UART_ASYNC_QUEUE_DEPTH];
+    volatile uint32_t done;
+    volatile uint32_t head;
+    volatile uint32_t tail;
+} uart_async_queue_t;
+
+/*******************************************************************************
+*  Global Variables
+*******************************************************************************/
+static uart_async_queue_t tx_queue[UART_ASYNC_TX_PRIORITIES];
+static uart_async_queue_t rx_queue;
+
+/* TX priority queue of the frame being transmitted */
+static volatile uint32_t tx_active_priority = UART_ASYNC_TX_IDLE;
+
+/* Longest head-of-line wait per TX priority */
+uint32_t uart_async_tx_wait_max[UART_ASYNC_TX_PRIORITIES];
+
+/* Highest number of outstanding requests per TX priority */
+uint32_t uart_async_tx_queue_max[UART_ASYNC_TX_PRIORITIES];
+
+/*******************************************************************************
+* Function Name: uart_async_tx_start_next
+********************************************************************************
+* Summary:
+* Starts the head frame of the highest priority TX queue that is not empty.
+* Called at frame boundaries only, so a control frame waits for at most one
+* frame of lower priority. The queue is only marked active if the FIFO driver
+* accepted the write; otherwise the frame stays queued and is retried on the
+* next queued frame or completed write. Call with interrupts disabled.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void uart_async_tx_start_next(void)
+{
+    tx_active_priority = UART_ASYNC_TX_IDLE;
+
+    for (uint32_t priority = 0U; priority < UART_ASYNC_TX_PRIORITIES; priority++)
+    {
+        uart_async_queue_t *queue = &tx_queue[priority];
+
+        if (queue->head != queue->tail)
+        {
+            uart_async_request_t *next = &queue->request[queue->head & UART_ASYNC_QUEUE_MASK];
+            uint32_t wait = uart_cycles_elapsed(next->queued);
+
+            if (wait > uart_async_tx_wait_max[priority])
+            {
+                uart_async_tx_wait_max[priority] = wait;
+            }
+
+            if (uart_fifo_write(next->buffer, next->length))
+            {
+                tx_active_priority = priority;
+            }
+            break;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: uart_async_tx_done
+********************************************************************************
+* Summary:
+* Write completion from the TX ISR. Starts the next queued frame by priority
+* right away to keep the line busy and defers the callback to PendSV. The
+* queues are also changed from the RX ISR (stats reply), so the whole update
+* runs with interrupts disabled.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void uart_async_tx_done(void)
+{
+    UART_ASYNC_ENTER_CRITICAL();
+
+    if (tx_active_priority != UART_ASYNC_TX_IDLE)
+    {
+        tx_queue[tx_active_priority].head++;
+    }
+
+    uart_async_tx_start_next();
+
+    UART_ASYNC_EXIT_CRITICAL();
+
+    SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+}
+
+/*******************************************************************************
+* Function Name: uart_async_rx_done
+********************************************************************************
+* Summary:
+* Read completion from the RX ISR. Starts the next queued read right away and
+* defers the callback to PendSV.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void uart_async_rx_done(void)
+{
+    UART_ASYNC_ENTER_CRITICAL();
+
+    rx_queue.head++;
+
+    if (rx_queue.head != rx_queue.tail)
+    {
+        uart_async_request_t *next = &rx_queue.request[rx_queue.head & UART_ASYNC_QUEUE_MASK];
+        (void)UART_ASYNC_READ(next);
+    }
+
+    UART_ASYNC_EXIT_CRITICAL();
+
+    SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+}
+
+/*******************************************************************************
+* Function Name: uart_async_complete
+********************************************************************************
+* Summary:
+* Calls the callbacks of all completed requests of a queue. The slot is
+* released before its callback runs, so the callback can queue a new request.
+*
+* Parameters:
+*  queue: Request queue
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void uart_async_complete(uart_async_queue_t *queue)
+{
+    while (queue->done != queue->head)
+    {
+        uart_async_request_t request = queue->request[queue->done & UART_ASYNC_QUEUE_MASK];
+
+        queue->done++;
+        if (request.callback != NULL)
+        {
+            request.callback(request.buffer, request.length);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: PendSV_Handler
+********************************************************************************
+* Summary:
+* Deferred completion context. Runs the callbacks of completed writes and
+* reads at the lowest interrupt priority.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void PendSV_Handler(void)
+{
+    for (uint32_t priority = 0U; priority < UART_ASYNC_TX_PRIORITIES; priority++)
+    {
+        uart_async_complete(&tx_queue[priority]);
+    }
+    uart_async_complete(&rx_queue);
+}
+
+/*******************************************************************************
+* Function Name: uart_async_enqueue
+********************************************************************************
+* Summary:
+* Adds a request to a queue. Returns whether the queue was idle, in which case
+* the caller starts the request.
+*
+* Parameters:
+*  queue:    Request queue
+*  buffer:   Transfer buffer
+*  length:   Number of bytes
+*  callback: Completion callback (can be NULL)
+*  idle:     Set to true if the request is the only one queued (can be NULL)
+*
+* Return:
+*  uart_async_status_t
+*
+*******************************************************************************/
+static uart_async_status_t uart_async_enqueue(uart_async_queue_t *queue, uint8_t *buffer,
+                                              uint32_t length, uart_async_callback_t callback,
+                                              bool *idle)
+{
+    uart_async_request_t *request;
+
+    if ((buffer == NULL) || (length == 0U))
+    {
+        return UART_ASYNC_INVALID;
+    }
+
+    if ((queue->tail - queue->done) >= UART_ASYNC_QUEUE_DEPTH)
+    {
+        return UART_ASYNC_QUEUE_FULL;
+    }
+
+    request = &queue->request[queue->tail & UART_ASYNC_QUEUE_MASK];
+    request->buffer = buffer;
+    request->length = length;
+    request->callback = callback;
+    request->queued = uart_cycles_now();
+
+    if (idle != NULL)
+    {
+        *idle = (queue->head == queue->tail);
+    }
+    queue->tail++;
+
+    return UART_ASYNC_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: uart_async_init
+********************************************************************************
+* Summary:
+* Registers the completion handling with the FIFO driver. Call after
+* uart_fifo_init().
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void uart_async_init(void)
+{
+    NVIC_SetPriority(PendSV_IRQn, (1UL << __NVIC_PRIO_BITS) - 1UL);
+    uart_fifo_register_callbacks(uart_async_tx_done, uart_async_rx_done);
+}
+
+/*******************************************************************************
+* Function Name: uart_tx_async
+********************************************************************************
+* Summary:
+* Queues a write with bulk priority. The buffer must stay valid until the
+* callback is called.
+*
+* Parameters:
+*  buffer:   Data to transmit
+*  length:   Number of bytes
+*  callback: Called from PendSV when the data has been moved to the TX FIFO
+*
+* Return:
+*  uart_async_status_t
+*
+*******************************************************************************/
+uart_async_status_t uart_tx_async(const uint8_t *buffer, uint32_t length,
+                                  uart_async_callback_t callback)
+{
+    return uart_tx_async_priority(buffer, length, UART_ASYNC_PRIORITY_BULK, callback);
+}
+
+/*******************************************************************************
+* Function Name: uart_tx_async_priority
+********************************************************************************
+* Summary:
+* Queues a frame into a TX priority queue. The frame is transmitted as a
+* whole; a higher priority frame queued meanwhile is sent next, ahead of
+* queued frames of lower priority. The buffer must stay valid until the
+* callback is called.
+*
+* Parameters:
+*  buffer:   Data to transmit
+*  length:   Number of bytes
+*  priority: TX queue, 0 (UART_ASYNC_PRIORITY_CONTROL) is the highest
+*  callback: Called from PendSV when the data has been moved to the TX FIFO
+*
+* Return:
+*  uart_async_status_t
+*
+*******************************************************************************/
+uart_async_status_t uart_tx_async_priority(const uint8_t *buffer, uint32_t length,
+                                           uint32_t priority, uart_async_callback_t callback)
+{
+    uart_async_status_t status;
+
+    if (priority >= UART_ASYNC_TX_PRIORITIES)
+    {
+        return UART_ASYNC_INVALID;
+    }
+
+    UART_ASYNC_ENTER_CRITICAL();
+
+    /* The request keeps a non-const pointer, TX never writes to it */
+    status = uart_async_enqueue(&tx_queue[priority], (uint8_t *)buffer, length, callback, NULL);
+    if (status == UART_ASYNC_SUCCESS)
+    {
+        uint32_t outstanding = tx_queue[priority].tail - tx_queue[priority].done;
+
+        if (outstanding > uart_async_tx_queue_max[priority])
+        {
+            uart_async_tx_queue_max[priority] = outstanding;
+        }
+
+        if (tx_active_priority == UART_ASYNC_TX_IDLE)
+        {
+            uart_async_tx_start_next();
+        }
+    }
+
+    UART_ASYNC_EXIT_CRITICAL();
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Name: uart_rx_async_start
+********************************************************************************
+* Summary:
+* Queues a read with an optional error map, and starts it if the RX queue
+* was idle.
+*
+* Parameters:
+*  buffer:    Buffer for the received data
+*  error_map: Parity error map (UART_RX_STATUS_ENABLE, can be NULL)
+*  length:    Number of bytes
+*  callback:  Called from PendSV when the buffer is full
+*
+* Return:
+*  uart_async_status_t
+*
+*******************************************************************************/
+static uart_async_status_t uart_rx_async_start(uint8_t *buffer, uint32_t *error_map, uint32_t length,
+                                               uart_async_callback_t callback)
+{
+    uart_async_status_t status;
+    bool idle = false;
+
+    UART_ASYNC_ENTER_CRITICAL();
+
+    status = uart_async_enqueue(&rx_queue, buffer, length, callback, &idle);
+    if (status == UART_ASYNC_SUCCESS)
+    {
+        uart_async_request_t *request = &rx_queue.request[(rx_queue.tail - 1U) & UART_ASYNC_QUEUE_MASK];
+
+#if (UART_RX_STATUS_ENABLE == 1)
+        request->error_map = error_map;
+#else
+        (void)error_map;
+#endif
+        if (idle)
+        {
+            (void)UART_ASYNC_READ(request);
+        }
+    }
+
+    UART_ASYNC_EXIT_CRITICAL();
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Name: uart_rx_async
+********************************************************************************
+* Summary:
+* Queues a read. The buffer must stay valid until the callback is called.
+*
+* Parameters:
+*  buffer:   Buffer for the received data
+*  length:   Number of bytes
+*  callback: Called from PendSV when the buffer is full
+*
+* Return:
+*  uart_async_status_t
+*
+*******************************************************************************/
+uart_async_status_t uart_rx_async(uint8_t *buffer, uint32_t length,
+                                  uart_async_callback_t callback)
+{
+    return uart_rx_async_start(buffer, NULL, length, callback);
+}
+
+#if (UART_RX_STATUS_ENABLE == 1)
+/*******************************************************************************
+* Function Name: uart_rx_async_status
+********************************************************************************
+* Summary:
+* Queues a read that also records the parity error of every byte, see
+* uart_fifo_read_status(). Buffer and error map must stay valid until the
+* callback is called.
+*
+* Parameters:
+*  buffer:    Buffer for the received data
+*  error_map: Parity error map, UART_RX_STATUS_WORDS(length) words
+*  length:    Number of bytes
+*  callback:  Called from PendSV when the buffer is full
+*
+* Return:
+*  uart_async_status_t
+*
+*******************************************************************************/
+uart_async_status_t uart_rx_async_status(uint8_t *buffer, uint32_t *error_map, uint32_t length,
+                                         uart_async_callback_t callback)
+{
+    return uart_rx_async_start(buffer, error_map, length, callback);
+}
+#endif
+
+#endif /* !defined(COMPONENT_FREERTOS) */
+
+/* [] END OF FILE */
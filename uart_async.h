@@ -0,0 +1,113 @@
+/******************************************************************************
+* File Name:   uart_async.h
+*
+* Description: This file contains the interface of the asynchronous transfer API.
+*              Requests are queued per direction and their completion callbacks
+*              are called from PendSV.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#ifndef UART_ASYNC_H_
+#define UART_ASYNC_H_
+
+#include <stdint.h>
+#include "uart_config.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+/* Outstanding requests per direction, power of two */
+#ifndef UART_ASYNC_QUEUE_DEPTH
+#define UART_ASYNC_QUEUE_DEPTH          4U
+#endif
+
+/* Number of TX priority queues, 0 is the highest priority */
+#ifndef UART_ASYNC_TX_PRIORITIES
+#define UART_ASYNC_TX_PRIORITIES        2U
+#endif
+
+/* Priority of control frames and of bulk data used by uart_tx_async() */
+#define UART_ASYNC_PRIORITY_CONTROL     0U
+#define UART_ASYNC_PRIORITY_BULK        (UART_ASYNC_TX_PRIORITIES - 1U)
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+typedef enum
+{
+    UART_ASYNC_SUCCESS = 0,
+    UART_ASYNC_QUEUE_FULL,      /* UART_ASYNC_QUEUE_DEPTH requests outstanding */
+    UART_ASYNC_INVALID          /* NULL buffer, zero length or invalid priority */
+} uart_async_status_t;
+
+/* Completion callback, called from PendSV with the buffer of the request */
+typedef void (*uart_async_callback_t)(const uint8_t *buffer, uint32_t length);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Longest head-of-line wait per TX priority: cycles from queueing a frame to
+ * the start of its transmission
+ */
+extern uint32_t uart_async_tx_wait_max[UART_ASYNC_TX_PRIORITIES];
+
+/* High-water mark of outstanding requests per TX priority */
+extern uint32_t uart_async_tx_queue_max[UART_ASYNC_TX_PRIORITIES];
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void uart_async_init(void);
+uart_async_status_t uart_tx_async(const uint8_t *buffer, uint32_t length,
+                                  uart_async_callback_t callback);
+uart_async_status_t uart_tx_async_priority(const uint8_t *buffer, uint32_t length,
+                                           uint32_t priority, uart_async_callback_t callback);
+uart_async_status_t uart_rx_async(uint8_t *buffer, uint32_t length,
+                                  uart_async_callback_t callback);
+#if (UART_RX_STATUS_ENABLE == 1)
+uart_async_status_t uart_rx_async_status(uint8_t *buffer, uint32_t *error_map, uint32_t length,
+                                         uart_async_callback_t callback);
+#endif
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* UART_ASYNC_H_ */
+
+/* [] END OF FILE */
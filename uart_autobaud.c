@@ -0,0 +1,229 @@
+/******************************************************************************
+* File Name:   uart_autobaud.c
+*
+* Description: This file contains the automatic baud rate detection. The USIC
+*              capture mode timer measures the bit times of a sync character
+*              and the fractional divider is reprogrammed to the detected rate.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#include "uart_autobaud.h"
+#include "uart_baud.h"
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+/* Divider step for fFD = fPERIPH in normal divider mode */
+#define UART_AUTOBAUD_FDR_STEP_DIV1     1023U
+
+/*******************************************************************************
+* Function Name: uart_autobaud_setup_timer
+********************************************************************************
+* Summary:
+* Configures the baud rate generator as measurement clock for the capture mode
+* timer. The PDIV prescaler is chosen so that one bit time at
+* UART_AUTOBAUD_MIN_BAUDRATE does not saturate the 10-bit timer.
+*
+* Parameters:
+*  channel: USIC channel used for the measurement
+*
+* Return:
+*  uint32_t: Measurement clock frequency (fPDIV) in Hz
+*
+*******************************************************************************/
+static uint32_t uart_autobaud_setup_timer(XMC_USIC_CH_t *const channel)
+{
+    uint32_t periph_clock = XMC_SCU_CLOCK_GetPeripheralClockFrequency();
+    uint32_t max_clock = UART_AUTOBAUD_MIN_BAUDRATE * UART_AUTOBAUD_CAPTURE_MAX;
+    uint32_t pdiv = (periph_clock + max_clock - 1U) / max_clock;
+
+    XMC_USIC_CH_SetFractionalDivider(channel, XMC_USIC_CH_BRG_CLOCK_DIVIDER_MODE_NORMAL,
+                                     UART_AUTOBAUD_FDR_STEP_DIV1);
+    XMC_USIC_CH_SetBaudrateDivider(channel, XMC_USIC_CH_BRG_CLOCK_SOURCE_DIVIDER, false,
+                                   pdiv - 1U, XMC_USIC_CH_BRG_CTQSEL_PDIV, 0U, 0U);
+
+    return periph_clock / pdiv;
+}
+
+/*******************************************************************************
+* Function Name: uart_autobaud_calculate
+********************************************************************************
+* Summary:
+* Calculates the baud rate from the captured bit intervals. Every interval
+* must be below the timer saturation value and within
+* UART_AUTOBAUD_TOLERANCE_16TH of the average, otherwise the received
+* character is rejected.
+*
+* Parameters:
+*  clock_hz:  Measurement clock frequency in Hz
+*  intervals: Captured intervals, one bit time each
+*  count:     Number of intervals
+*  result:    Detected baud rate and measurement details
+*
+* Return:
+*  uart_autobaud_status_t
+*
+*******************************************************************************/
+uart_autobaud_status_t uart_autobaud_calculate(uint32_t clock_hz,
+                                               const uint16_t *intervals,
+                                               uint32_t count,
+                                               uart_autobaud_result_t *result)
+{
+    uint32_t sum = 0U;
+    uint32_t average;
+    uint32_t tolerance;
+
+    if (count == 0U)
+    {
+        return UART_AUTOBAUD_STATUS_INVALID_PATTERN;
+    }
+
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        if ((intervals[i] == 0U) || (intervals[i] >= UART_AUTOBAUD_CAPTURE_MAX))
+        {
+            return UART_AUTOBAUD_STATUS_OUT_OF_RANGE;
+        }
+        sum += intervals[i];
+    }
+
+    average = sum / count;
+    tolerance = (average * UART_AUTOBAUD_TOLERANCE_16TH) / 16U;
+
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        uint32_t deviation = (intervals[i] > average) ? (intervals[i] - average)
+                                                      : (average - intervals[i]);
+        if (deviation > tolerance)
+        {
+            return UART_AUTOBAUD_STATUS_INVALID_PATTERN;
+        }
+    }
+
+    result->clock_hz = clock_hz;
+    result->ticks = sum;
+    result->baudrate = (uint32_t)((((uint64_t)clock_hz * count) + (sum / 2U)) / sum);
+
+    return UART_AUTOBAUD_STATUS_OK;
+}
+
+/*******************************************************************************
+* Function Name: uart_autobaud_detect
+********************************************************************************
+* Summary:
+* Waits for the sync character on the RX line and measures it with the
+* capture mode timer. DX1 is triggered on both edges and every capture is
+* written to the RX FIFO. On success the channel is reprogrammed to the
+* detected baud rate, otherwise the previous divider settings are restored.
+* The RX FIFO interrupt must be disabled while this function runs.
+*
+* Parameters:
+*  channel: USIC channel configured for UART
+*  timeout: Maximum number of polling iterations
+*  result:  Detected baud rate and measurement details
+*
+* Return:
+*  uart_autobaud_status_t
+*
+*******************************************************************************/
+uart_autobaud_status_t uart_autobaud_detect(XMC_USIC_CH_t *const channel,
+                                            uint32_t timeout,
+                                            uart_autobaud_result_t *result)
+{
+    uint16_t captures[UART_AUTOBAUD_NUM_CAPTURES];
+    uint32_t num_captures = 0U;
+    uint32_t poll_count = 0U;
+    uint32_t saved_fdr = channel->FDR;
+    uint32_t saved_brg = channel->BRG;
+    uint32_t clock_hz;
+    uart_baud_config_t baud_config;
+    uart_autobaud_status_t status;
+
+    clock_hz = uart_autobaud_setup_timer(channel);
+
+    XMC_USIC_CH_RXFIFO_Flush(channel);
+    XMC_USIC_CH_SetInputSource(channel, XMC_USIC_CH_INPUT_DX1, UART_AUTOBAUD_DX1_SOURCE);
+    XMC_USIC_CH_SetInputTriggerCombinationMode(channel, XMC_USIC_CH_INPUT_DX1,
+                                               XMC_USIC_CH_INPUT_COMBINATION_MODE_BOTH_EDGES);
+    XMC_USIC_CH_EnableTimeMeasurement(channel);
+
+    /* Collect one capture per edge of the sync character */
+    while ((num_captures < UART_AUTOBAUD_NUM_CAPTURES) && (poll_count < timeout))
+    {
+        if (!XMC_USIC_CH_RXFIFO_IsEmpty(channel))
+        {
+            captures[num_captures++] = XMC_USIC_CH_RXFIFO_GetData(channel) & UART_AUTOBAUD_CAPTURE_MAX;
+        }
+        poll_count++;
+    }
+
+    XMC_USIC_CH_DisableTimeMeasurement(channel);
+    XMC_USIC_CH_SetInputTriggerCombinationMode(channel, XMC_USIC_CH_INPUT_DX1,
+                                               XMC_USIC_CH_INPUT_COMBINATION_MODE_TRIGGER_DISABLED);
+
+    if (num_captures < UART_AUTOBAUD_NUM_CAPTURES)
+    {
+        status = UART_AUTOBAUD_STATUS_TIMEOUT;
+    }
+    else
+    {
+        /* The first capture is the idle time before the start bit */
+        status = uart_autobaud_calculate(clock_hz, &captures[1], UART_AUTOBAUD_NUM_INTERVALS, result);
+    }
+    result->poll_count = poll_count;
+
+    if ((status == UART_AUTOBAUD_STATUS_OK) &&
+        (uart_baud_solve(XMC_SCU_CLOCK_GetPeripheralClockFrequency(), result->baudrate,
+                         &baud_config) != UART_BAUD_STATUS_OK))
+    {
+        status = UART_AUTOBAUD_STATUS_OUT_OF_RANGE;
+    }
+
+    if (status == UART_AUTOBAUD_STATUS_OK)
+    {
+        uart_baud_apply(channel, &baud_config);
+    }
+    else
+    {
+        channel->FDR = saved_fdr;
+        channel->BRG = saved_brg;
+    }
+
+    /* Drop the sync character itself if the receiver picked it up */
+    XMC_USIC_CH_RXFIFO_Flush(channel);
+
+    return status;
+}
+
+/* [] END OF FILE */
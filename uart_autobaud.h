@@ -0,0 +1,138 @@
+/******************************************************************************
+* File Name:   uart_autobaud.h
+*
+* Description: This file contains the interface of the automatic baud rate
+*              detection based on the USIC time measurement (capture mode timer).
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#ifndef UART_AUTOBAUD_H_
+#define UART_AUTOBAUD_H_
+
+#include <stdint.h>
+#include "xmc_uart.h"
+#include "uart_config.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+/* Synchronization character sent by the peer. 0x55 ('U') toggles the line on
+ * every bit boundary, so each captured interval is exactly one bit time.
+ */
+#define UART_AUTOBAUD_SYNC_CHAR         0x55U
+
+/* Start bit + 8 data bits + stop bit of the sync character give 10 edges.
+ * The first capture measures the idle time and is discarded.
+ */
+#define UART_AUTOBAUD_NUM_CAPTURES      10U
+#define UART_AUTOBAUD_NUM_INTERVALS     (UART_AUTOBAUD_NUM_CAPTURES - 1U)
+
+/* Lowest baud rate that can be measured. It sets the measurement clock so
+ * that one bit time at this rate still fits into the 10-bit capture timer.
+ */
+#ifndef UART_AUTOBAUD_MIN_BAUDRATE
+#define UART_AUTOBAUD_MIN_BAUDRATE      9600U
+#endif
+
+/* DX1 input source connected to the RX pin. DX1 carries the edges for the
+ * time measurement while DX0 stays connected for normal reception. There is
+ * no default, because the mapping differs per device: look up the DX1 input
+ * of the RX pin in the USIC input mapping table of the reference manual.
+ * RX pins of the kits (design.modus templates):
+ *   KIT_XMC11/12/13/14_BOOT_001      P1.3, USIC0 channel 1
+ *   KIT_XMC43_RELAX_ECAT_V1          P1.4, USIC0 channel 0
+ *   KIT_XMC45_RELAX_V1               P1.4, USIC0 channel 0
+ *   KIT_XMC47_RELAX_V1               P6.3, USIC0 channel 1
+ *   KIT_XMC48_RELAX_ECAT_V1          P1.4, USIC0 channel 0
+ *   KIT_XMC_PLT2GO_XMC4200           P1.4, USIC0 channel 0
+ *   KIT_XMC_PLT2GO_XMC4400           P2.2, USIC0 channel 1
+ */
+#if !defined(UART_AUTOBAUD_DX1_SOURCE)
+#if (UART_AUTOBAUD_ENABLE == 1)
+#error "Define UART_AUTOBAUD_DX1_SOURCE as the DX1 input of the RX pin, see uart_autobaud.h"
+#else
+/* Not used while the detection is disabled */
+#define UART_AUTOBAUD_DX1_SOURCE        0U
+#endif
+#endif
+
+/* Maximum deviation of a single interval from the average, in 1/16 units
+ * (4 = 25 %). Larger deviations mean the received character is not 0x55.
+ */
+#define UART_AUTOBAUD_TOLERANCE_16TH    4U
+
+/* Capture mode timer saturation value (10-bit CMTR.CTV) */
+#define UART_AUTOBAUD_CAPTURE_MAX       0x3FFU
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+typedef enum
+{
+    UART_AUTOBAUD_STATUS_OK = 0,
+    UART_AUTOBAUD_STATUS_TIMEOUT,          /* No sync character received */
+    UART_AUTOBAUD_STATUS_OUT_OF_RANGE,     /* Capture timer saturated */
+    UART_AUTOBAUD_STATUS_INVALID_PATTERN   /* Intervals are not uniform */
+} uart_autobaud_status_t;
+
+typedef struct
+{
+    uint32_t baudrate;          /* Detected baud rate */
+    uint32_t clock_hz;          /* Measurement clock (fPDIV) */
+    uint32_t ticks;             /* Measurement clock ticks over all intervals */
+    uint32_t poll_count;        /* Polling iterations until lock */
+} uart_autobaud_result_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+uart_autobaud_status_t uart_autobaud_detect(XMC_USIC_CH_t *const channel,
+                                            uint32_t timeout,
+                                            uart_autobaud_result_t *result);
+uart_autobaud_status_t uart_autobaud_calculate(uint32_t clock_hz,
+                                               const uint16_t *intervals,
+                                               uint32_t count,
+                                               uart_autobaud_result_t *result);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* UART_AUTOBAUD_H_ */
+
+/* [] END OF FILE */
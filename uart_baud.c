@@ -0,0 +1,224 @@
+/******************************************************************************
+* File Name:   uart_baud.c
+*
+* Description: This file contains the baud rate solver. For a requested baud
+*              rate it searches the oversampling, PDIV and fractional divider
+*              settings with the smallest error. The solver has no peripheral
+*              dependencies and also builds on the host (UART_BAUD_HOST_BUILD).
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#include "uart_baud.h"
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+/* Resolution of the fractional divider (fFD = fPERIPH * STEP / 1024) */
+#define UART_BAUD_FDR_RESOLUTION        1024U
+
+#define UART_BAUD_PPM                   1000000
+
+/*******************************************************************************
+* Function Name: uart_baud_consider
+********************************************************************************
+* Summary:
+* Evaluates one divider candidate and keeps it if it is better than the best
+* candidate so far. A smaller error wins; on equal error the normal divider
+* mode (no clock jitter) and then the higher oversampling are preferred.
+*
+* Parameters:
+*  periph_clock: Peripheral clock frequency in Hz
+*  baudrate:     Requested baud rate
+*  candidate:    Divider settings to evaluate
+*  best:         Best divider settings so far, updated in place
+*  valid:        Set to true once best holds a candidate
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void uart_baud_consider(uint32_t periph_clock, uint32_t baudrate,
+                               uart_baud_config_t *candidate,
+                               uart_baud_config_t *best, bool *valid)
+{
+    uint64_t num;
+    uint64_t den;
+    int64_t error_ppm;
+    uint32_t abs_error;
+    uint32_t best_abs_error;
+
+    /* Achieved baud rate as exact fraction num / den */
+    if (candidate->fractional)
+    {
+        num = (uint64_t)periph_clock * candidate->step;
+        den = (uint64_t)UART_BAUD_FDR_RESOLUTION;
+    }
+    else
+    {
+        num = (uint64_t)periph_clock;
+        den = (uint64_t)(UART_BAUD_FDR_RESOLUTION - candidate->step);
+    }
+    den *= (uint64_t)(candidate->pdiv + 1U) * candidate->oversampling;
+
+    candidate->baudrate = (uint32_t)((num + (den / 2U)) / den);
+    error_ppm = (int64_t)(((num * UART_BAUD_PPM) + ((den * baudrate) / 2U)) / (den * baudrate)) - UART_BAUD_PPM;
+    candidate->error_ppm = (int32_t)error_ppm;
+
+    if (!*valid)
+    {
+        *best = *candidate;
+        *valid = true;
+        return;
+    }
+
+    abs_error = (uint32_t)((error_ppm < 0) ? -error_ppm : error_ppm);
+    best_abs_error = (uint32_t)((best->error_ppm < 0) ? -best->error_ppm : best->error_ppm);
+
+    if ((abs_error < best_abs_error) ||
+        ((abs_error == best_abs_error) && best->fractional && !candidate->fractional))
+    {
+        *best = *candidate;
+    }
+}
+
+/*******************************************************************************
+* Function Name: uart_baud_solve
+********************************************************************************
+* Summary:
+* Computes the divider settings for the requested baud rate.
+*   baud = fFD / ((PDIV + 1) * oversampling)
+*   normal mode:     fFD = fPERIPH / (1024 - STEP)
+*   fractional mode: fFD = fPERIPH * STEP / 1024
+* For every oversampling value the normal mode candidate and the fractional
+* candidate with the largest STEP (finest resolution) are evaluated.
+*
+* Parameters:
+*  periph_clock: Peripheral clock frequency (fPERIPH) in Hz
+*  baudrate:     Requested baud rate
+*  config:       Best divider settings and the achieved error
+*
+* Return:
+*  uart_baud_status_t
+*
+*******************************************************************************/
+uart_baud_status_t uart_baud_solve(uint32_t periph_clock, uint32_t baudrate,
+                                   uart_baud_config_t *config)
+{
+    uart_baud_config_t candidate;
+    bool valid = false;
+
+    if ((baudrate == 0U) || (baudrate > (periph_clock / UART_BAUD_OVERSAMPLING_MIN)))
+    {
+        return UART_BAUD_STATUS_OUT_OF_RANGE;
+    }
+
+    for (uint32_t oversampling = UART_BAUD_OVERSAMPLING_MAX;
+         oversampling >= UART_BAUD_OVERSAMPLING_MIN; oversampling--)
+    {
+        uint64_t bit_clock = (uint64_t)baudrate * oversampling;
+        uint32_t divider;
+        uint32_t pdiv;
+        uint32_t step;
+
+        candidate.oversampling = (uint8_t)oversampling;
+
+        /* Normal mode: split the integer divider into (1024 - STEP) * (PDIV + 1) */
+        divider = (uint32_t)((periph_clock + (bit_clock / 2U)) / bit_clock);
+        if (divider != 0U)
+        {
+            pdiv = (divider + (UART_BAUD_FDR_RESOLUTION - 1U)) / UART_BAUD_FDR_RESOLUTION;
+            step = (divider + (pdiv / 2U)) / pdiv;
+            if ((pdiv <= UART_BAUD_PDIV_MAX) && (step >= 1U) && (step <= UART_BAUD_FDR_RESOLUTION))
+            {
+                candidate.fractional = false;
+                candidate.pdiv = (uint16_t)(pdiv - 1U);
+                candidate.step = (uint16_t)(UART_BAUD_FDR_RESOLUTION - step);
+                uart_baud_consider(periph_clock, baudrate, &candidate, config, &valid);
+            }
+        }
+
+        /* Fractional mode: the largest PDIV that keeps STEP <= 1023 */
+        pdiv = (uint32_t)(((uint64_t)periph_clock * UART_BAUD_STEP_MAX) /
+                          (bit_clock * UART_BAUD_FDR_RESOLUTION));
+        if (pdiv > UART_BAUD_PDIV_MAX)
+        {
+            pdiv = UART_BAUD_PDIV_MAX;
+        }
+        if (pdiv != 0U)
+        {
+            step = (uint32_t)(((bit_clock * pdiv * UART_BAUD_FDR_RESOLUTION) + (periph_clock / 2U)) /
+                              periph_clock);
+            if ((step >= 1U) && (step <= UART_BAUD_STEP_MAX))
+            {
+                candidate.fractional = true;
+                candidate.pdiv = (uint16_t)(pdiv - 1U);
+                candidate.step = (uint16_t)step;
+                uart_baud_consider(periph_clock, baudrate, &candidate, config, &valid);
+            }
+        }
+    }
+
+    return valid ? UART_BAUD_STATUS_OK : UART_BAUD_STATUS_OUT_OF_RANGE;
+}
+
+#if !defined(UART_BAUD_HOST_BUILD)
+/*******************************************************************************
+* Function Name: uart_baud_apply
+********************************************************************************
+* Summary:
+* Programs the divider settings computed by uart_baud_solve() into the
+* channel. The sample point is moved to the middle of the bit.
+*
+* Parameters:
+*  channel: USIC channel configured for UART
+*  config:  Divider settings
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void uart_baud_apply(XMC_USIC_CH_t *const channel, const uart_baud_config_t *config)
+{
+    XMC_USIC_CH_SetFractionalDivider(channel,
+                                     config->fractional ? XMC_USIC_CH_BRG_CLOCK_DIVIDER_MODE_FRACTIONAL
+                                                        : XMC_USIC_CH_BRG_CLOCK_DIVIDER_MODE_NORMAL,
+                                     config->step);
+    XMC_USIC_CH_SetBaudrateDivider(channel, XMC_USIC_CH_BRG_CLOCK_SOURCE_DIVIDER, false,
+                                   config->pdiv, XMC_USIC_CH_BRG_CTQSEL_PDIV, 0U,
+                                   config->oversampling - 1U);
+    XMC_UART_CH_SetSamplePoint(channel, (config->oversampling >> 1U) + 1U);
+}
+#endif
+
+/* [] END OF FILE */
@@ -0,0 +1,103 @@
+/******************************************************************************
+* File Name:   uart_baud.h
+*
+* Description: This file contains the interface of the baud rate solver. It
+*              computes the fractional divider, PDIV and oversampling settings
+*              for a requested baud rate and reports the achieved error.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#ifndef UART_BAUD_H_
+#define UART_BAUD_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#if !defined(UART_BAUD_HOST_BUILD)
+#include "xmc_uart.h"
+#endif
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+/* Oversampling range supported by the ASC receiver (DCTQ + 1) */
+#define UART_BAUD_OVERSAMPLING_MIN      4U
+#define UART_BAUD_OVERSAMPLING_MAX      32U
+
+/* Range of the PDIV divider (PDIV + 1) */
+#define UART_BAUD_PDIV_MAX              1024U
+
+/* Range of the fractional divider STEP value */
+#define UART_BAUD_STEP_MAX              1023U
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+typedef enum
+{
+    UART_BAUD_STATUS_OK = 0,
+    UART_BAUD_STATUS_OUT_OF_RANGE       /* Baud rate above fPERIPH / 4 or zero */
+} uart_baud_status_t;
+
+typedef struct
+{
+    uint32_t baudrate;          /* Achieved baud rate */
+    int32_t error_ppm;          /* Achieved error relative to the request */
+    uint16_t step;              /* FDR.STEP */
+    uint16_t pdiv;              /* BRG.PDIV (divider - 1) */
+    uint8_t oversampling;       /* BRG.DCTQ + 1 */
+    bool fractional;            /* FDR.DM fractional (true) or normal mode */
+} uart_baud_config_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+uart_baud_status_t uart_baud_solve(uint32_t periph_clock, uint32_t baudrate,
+                                   uart_baud_config_t *config);
+
+#if !defined(UART_BAUD_HOST_BUILD)
+void uart_baud_apply(XMC_USIC_CH_t *const channel, const uart_baud_config_t *config);
+#endif
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* UART_BAUD_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,285 @@
+/******************************************************************************
+* File Name:   uart_cipher.c
+*
+* Description: This file contains the ChaCha20 stream cipher of the UART link
+*              (RFC 8439 block function). Each direction has its own keystream
+*              ring, filled block by block in the main loop. The block function
+*              has no dependencies and also builds on the host
+*              (UART_CIPHER_HOST_BUILD).
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#include "uart_cipher.h"
+
+#if !defined(UART_CIPHER_HOST_BUILD) && (UART_CIPHER_ENABLE == 1)
+#include "uart_cycles.h"
+#include "uart_fifo.h"
+
+#if (UART_SOAK_ENABLE == 1) || (UART_PRBS_ENABLE == 1) || (UART_PINGPONG_ENABLE == 1)
+#error "The test modes do not run the keystream generation of the cipher"
+#endif
+#endif
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+#define UART_CIPHER_ROTL(value, count)  (((value) << (count)) | ((value) >> (32U - (count))))
+
+#define UART_CIPHER_QUARTER_ROUND(a, b, c, d) \
+    do { \
+        (a) += (b); (d) ^= (a); (d) = UART_CIPHER_ROTL((d), 16U); \
+        (c) += (d); (b) ^= (c); (b) = UART_CIPHER_ROTL((b), 12U); \
+        (a) += (b); (d) ^= (a); (d) = UART_CIPHER_ROTL((d), 8U); \
+        (c) += (d); (b) ^= (c); (b) = UART_CIPHER_ROTL((b), 7U); \
+    } while (0)
+
+/*******************************************************************************
+* Function Name: uart_cipher_load32
+********************************************************************************
+* Summary:
+* Reads a 32-bit little endian word.
+*
+* Parameters:
+*  data: First byte
+*
+* Return:
+*  uint32_t
+*
+*******************************************************************************/
+static uint32_t uart_cipher_load32(const uint8_t *data)
+{
+    return (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+/*******************************************************************************
+* Function Name: uart_cipher_stream_init
+********************************************************************************
+* Summary:
+* Sets up a keystream with block counter 0 and an empty ring.
+*
+* Parameters:
+*  stream: Keystream
+*  key:    256-bit key
+*  nonce:  96-bit nonce, never reuse a nonce with the same key
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void uart_cipher_stream_init(uart_cipher_stream_t *stream, const uint8_t *key, const uint8_t *nonce)
+{
+    /* "expand 32-byte k" */
+    stream->input[0] = 0x61707865U;
+    stream->input[1] = 0x3320646EU;
+    stream->input[2] = 0x79622D32U;
+    stream->input[3] = 0x6B206574U;
+    for (uint32_t i = 0U; i < 8U; i++)
+    {
+        stream->input[4U + i] = uart_cipher_load32(&key[4U * i]);
+    }
+    stream->input[12] = 0U;
+    for (uint32_t i = 0U; i < 3U; i++)
+    {
+        stream->input[13U + i] = uart_cipher_load32(&nonce[4U * i]);
+    }
+
+    stream->head = 0U;
+    stream->tail = 0U;
+    stream->starved = false;
+}
+
+/*******************************************************************************
+* Function Name: uart_cipher_generate
+********************************************************************************
+* Summary:
+* Generates the next 64-byte keystream block into the ring if there is room.
+* The block is complete before the interrupts can use it.
+*
+* Parameters:
+*  stream: Keystream
+*
+* Return:
+*  bool: true if a block was generated
+*
+*******************************************************************************/
+bool uart_cipher_generate(uart_cipher_stream_t *stream)
+{
+    uint32_t x[16];
+    uint8_t *block;
+
+    if ((stream->head - stream->tail) > (UART_CIPHER_BUFFER - UART_CIPHER_BLOCK_SIZE))
+    {
+        return false;
+    }
+
+    for (uint32_t i = 0U; i < 16U; i++)
+    {
+        x[i] = stream->input[i];
+    }
+    for (uint32_t round = 0U; round < 10U; round++)
+    {
+        UART_CIPHER_QUARTER_ROUND(x[0], x[4], x[8], x[12]);
+        UART_CIPHER_QUARTER_ROUND(x[1], x[5], x[9], x[13]);
+        UART_CIPHER_QUARTER_ROUND(x[2], x[6], x[10], x[14]);
+        UART_CIPHER_QUARTER_ROUND(x[3], x[7], x[11], x[15]);
+        UART_CIPHER_QUARTER_ROUND(x[0], x[5], x[10], x[15]);
+        UART_CIPHER_QUARTER_ROUND(x[1], x[6], x[11], x[12]);
+        UART_CIPHER_QUARTER_ROUND(x[2], x[7], x[8], x[13]);
+        UART_CIPHER_QUARTER_ROUND(x[3], x[4], x[9], x[14]);
+    }
+
+    /* The head is a multiple of the block size, the block is contiguous */
+    block = &stream->keystream[stream->head & (UART_CIPHER_BUFFER - 1U)];
+    for (uint32_t i = 0U; i < 16U; i++)
+    {
+        uint32_t word = x[i] + stream->input[i];
+
+        block[4U * i] = (uint8_t)word;
+        block[(4U * i) + 1U] = (uint8_t)(word >> 8);
+        block[(4U * i) + 2U] = (uint8_t)(word >> 16);
+        block[(4U * i) + 3U] = (uint8_t)(word >> 24);
+    }
+    stream->input[12]++;
+
+#if !defined(UART_CIPHER_HOST_BUILD)
+    __DMB();
+#endif
+    stream->head += UART_CIPHER_BLOCK_SIZE;
+
+    return true;
+}
+
+#if !defined(UART_CIPHER_HOST_BUILD) && (UART_CIPHER_ENABLE == 1)
+/*******************************************************************************
+*  Global Variables
+*******************************************************************************/
+uart_cipher_stream_t uart_cipher_tx;
+uart_cipher_stream_t uart_cipher_rx;
+
+/*******************************************************************************
+* Function Name: uart_cipher_init
+********************************************************************************
+* Summary:
+* Sets up both directions and fills their keystream rings. Call after
+* uart_fifo_init() and before the first transfer. For a loopback, pass the
+* same nonce for both directions.
+*
+* Parameters:
+*  key:      256-bit key shared with the peer
+*  tx_nonce: Nonce of the transmitted stream
+*  rx_nonce: Nonce of the received stream
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void uart_cipher_init(const uint8_t *key, const uint8_t *tx_nonce, const uint8_t *rx_nonce)
+{
+    uart_cipher_stream_init(&uart_cipher_tx, key, tx_nonce);
+    uart_cipher_stream_init(&uart_cipher_rx, key, rx_nonce);
+
+    while (uart_cipher_generate(&uart_cipher_tx))
+    {
+    }
+    while (uart_cipher_generate(&uart_cipher_rx))
+    {
+    }
+}
+
+/*******************************************************************************
+* Function Name: uart_cipher_process
+********************************************************************************
+* Summary:
+* Background part of the cipher, call it from the main loop. Generates one
+* block per direction if there is room, and resumes a transfer that stopped
+* for want of keystream.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void uart_cipher_process(void)
+{
+    (void)uart_cipher_generate(&uart_cipher_rx);
+    (void)uart_cipher_generate(&uart_cipher_tx);
+
+    if (uart_cipher_rx.starved || uart_cipher_tx.starved)
+    {
+        uart_cipher_rx.starved = false;
+        uart_cipher_tx.starved = false;
+        uart_fifo_resume();
+    }
+}
+
+/*******************************************************************************
+* Function Name: uart_cipher_benchmark
+********************************************************************************
+* Summary:
+* Measures the keystream generation, using the TX stream as scratch. Call
+* before uart_cipher_init(). The highest sustained rate per direction is
+* SystemCoreClock / cycles per byte.
+*
+* Parameters:
+*  blocks: Number of blocks to generate, must take less than one SysTick
+*          period on XMC1
+*
+* Return:
+*  uint32_t: CPU cycles per keystream byte
+*
+*******************************************************************************/
+uint32_t uart_cipher_benchmark(uint32_t blocks)
+{
+    static const uint8_t zero[UART_CIPHER_KEY_SIZE];
+    uint32_t start;
+    uint32_t cycles;
+
+    uart_cycles_init();
+    uart_cipher_stream_init(&uart_cipher_tx, zero, zero);
+
+    start = uart_cycles_now();
+    for (uint32_t i = 0U; i < blocks; i++)
+    {
+        (void)uart_cipher_generate(&uart_cipher_tx);
+        uart_cipher_tx.tail = uart_cipher_tx.head;
+    }
+    cycles = uart_cycles_elapsed(start);
+
+    return cycles / (blocks * UART_CIPHER_BLOCK_SIZE);
+}
+#endif
+
+/* [] END OF FILE */
@@ -0,0 +1,182 @@
+/******************************************************************************
+* File Name:   uart_cipher.h
+*
+* Description: This file contains the interface of the ChaCha20 stream cipher of the
+*              UART link. The keystream is generated ahead in the main loop, the FIFO
+*              interrupts only XOR it into the data.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#ifndef UART_CIPHER_H_
+#define UART_CIPHER_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "uart_config.h"
+
+#if !defined(UART_CIPHER_HOST_BUILD)
+#include "xmc_common.h"
+#endif
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+/* Keystream generated ahead per direction (power of two, at least 64). It
+ * bridges the time between two calls of uart_cipher_process().
+ */
+#ifndef UART_CIPHER_BUFFER
+#define UART_CIPHER_BUFFER              256U
+#endif
+
+#define UART_CIPHER_KEY_SIZE            32U
+#define UART_CIPHER_NONCE_SIZE          12U
+#define UART_CIPHER_BLOCK_SIZE          64U
+
+#if ((UART_CIPHER_BUFFER & (UART_CIPHER_BUFFER - 1U)) != 0U) || (UART_CIPHER_BUFFER < UART_CIPHER_BLOCK_SIZE)
+#error "UART_CIPHER_BUFFER must be a power of two of at least 64"
+#endif
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+typedef struct
+{
+    uint8_t keystream[UART_CIPHER_BUFFER];
+    volatile uint32_t head;     /* Keystream bytes generated */
+    volatile uint32_t tail;     /* Keystream bytes used */
+    volatile bool starved;      /* A transfer waits for keystream */
+    uint32_t input[16];         /* ChaCha20 constants, key, block counter, nonce */
+} uart_cipher_stream_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void uart_cipher_stream_init(uart_cipher_stream_t *stream, const uint8_t *key, const uint8_t *nonce);
+bool uart_cipher_generate(uart_cipher_stream_t *stream);
+
+#if !defined(UART_CIPHER_HOST_BUILD) && (UART_CIPHER_ENABLE == 1)
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+extern uart_cipher_stream_t uart_cipher_tx;
+extern uart_cipher_stream_t uart_cipher_rx;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void uart_cipher_init(const uint8_t *key, const uint8_t *tx_nonce, const uint8_t *rx_nonce);
+void uart_cipher_process(void);
+uint32_t uart_cipher_benchmark(uint32_t blocks);
+
+/*******************************************************************************
+* Function Name: uart_cipher_budget
+********************************************************************************
+* Summary:
+* Returns how many bytes the FIFO interrupt may move: the byte budget,
+* limited by the keystream available.
+*
+* Parameters:
+*  stream: Keystream of the direction
+*  budget: Byte budget of the interrupt entry
+*
+* Return:
+*  uint32_t
+*
+*******************************************************************************/
+static inline uint32_t uart_cipher_budget(const uart_cipher_stream_t *stream, uint32_t budget)
+{
+    uint32_t available = stream->head - stream->tail;
+
+    return (available < budget) ? available : budget;
+}
+
+/*******************************************************************************
+* Function Name: uart_cipher_starved
+********************************************************************************
+* Summary:
+* Checks whether the keystream is used up. If so, the direction is marked
+* so that uart_cipher_process() resumes the transfer.
+*
+* Parameters:
+*  stream: Keystream of the direction
+*
+* Return:
+*  bool
+*
+*******************************************************************************/
+static inline bool uart_cipher_starved(uart_cipher_stream_t *stream)
+{
+    if (stream->head != stream->tail)
+    {
+        return false;
+    }
+    stream->starved = true;
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: uart_cipher_apply
+********************************************************************************
+* Summary:
+* Encrypts or decrypts one byte: one keystream load and one XOR. The caller
+* checks the keystream with uart_cipher_budget() first.
+*
+* Parameters:
+*  stream: Keystream of the direction
+*  data:   Byte to encrypt or decrypt
+*
+* Return:
+*  uint8_t
+*
+*******************************************************************************/
+static inline uint8_t uart_cipher_apply(uart_cipher_stream_t *stream, uint8_t data)
+{
+    uint32_t tail = stream->tail;
+
+    stream->tail = tail + 1U;
+    return data ^ stream->keystream[tail & (UART_CIPHER_BUFFER - 1U)];
+}
+#endif
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* UART_CIPHER_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,101 @@
+/******************************************************************************
+* File Name:   uart_coalesce.c
+*
+* Description: This file contains the interrupt coalescing. The RX FIFO limit is
+*              raised as far as the latency budget allows, the TX FIFO limit is
+*              kept as low as the interrupt latency allows.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#include "uart_coalesce.h"
+
+/*******************************************************************************
+* Function Name: uart_coalesce_compute
+********************************************************************************
+* Summary:
+* Computes the FIFO limits that minimize interrupts per byte within the
+* latency budget.
+* RX: the first byte of a batch waits rx_limit byte times for the event, so
+*     rx_limit = budget / byte time, capped so that the FIFO still has room
+*     for the bytes arriving during the interrupt latency. Bytes of a stream
+*     tail below the limit are drained by the fallback timer within the
+*     budget: it pends the drain when the level did not change over one
+*     period, so a tail waits up to two periods and the period is half the
+*     budget.
+* TX: the handler refills the FIFO completely. The event fires when the level
+*     falls below tx_limit, which must cover the interrupt latency to avoid
+*     a gap on the line.
+*
+* Parameters:
+*  baudrate:          Baud rate of the channel
+*  frame_bits:        Bits per frame, see uart_fifo_frame_bits()
+*  latency_budget_us: Maximum added RX latency in microseconds
+*  fifo_size:         FIFO size in words
+*  config:            Selected limits and fallback timer period
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void uart_coalesce_compute(uint32_t baudrate, uint32_t frame_bits, uint32_t latency_budget_us,
+                           uint32_t fifo_size, uart_coalesce_config_t *config)
+{
+    uint32_t byte_time_ns = (uint32_t)((frame_bits * 1000000000ULL) / baudrate);
+    uint32_t headroom;
+    uint32_t budget_bytes;
+
+    /* Bytes transferred during the interrupt latency, at least one */
+    headroom = (UART_COALESCE_ISR_LATENCY_NS + byte_time_ns - 1U) / byte_time_ns;
+    if (headroom == 0U)
+    {
+        headroom = 1U;
+    }
+    if (headroom > (fifo_size - 1U))
+    {
+        headroom = fifo_size - 1U;
+    }
+
+    config->tx_limit = headroom;
+
+    budget_bytes = (uint32_t)(((uint64_t)latency_budget_us * 1000U) / byte_time_ns);
+    config->rx_limit = fifo_size - 1U - headroom;
+    if (budget_bytes < config->rx_limit)
+    {
+        config->rx_limit = budget_bytes;
+    }
+
+    config->timer_period_us = (config->rx_limit == 0U) ? 0U : ((latency_budget_us + 1U) / 2U);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,81 @@
+/******************************************************************************
+* File Name:   uart_coalesce.h
+*
+* Description: This file contains the interface of the interrupt coalescing. It
+*              selects the TX and RX FIFO limits for a given latency budget.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#ifndef UART_COALESCE_H_
+#define UART_COALESCE_H_
+
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+/* Worst-case time from a FIFO event to the first FIFO access in the
+ * interrupt handler. It sets the headroom kept in both FIFOs.
+ */
+#ifndef UART_COALESCE_ISR_LATENCY_NS
+#define UART_COALESCE_ISR_LATENCY_NS    2000U
+#endif
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+typedef struct
+{
+    uint32_t tx_limit;          /* TX FIFO limit, event when the level falls below */
+    uint32_t rx_limit;          /* RX FIFO limit, event when the level exceeds */
+    uint32_t timer_period_us;   /* Fallback drain period, 0 = not needed */
+} uart_coalesce_config_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void uart_coalesce_compute(uint32_t baudrate, uint32_t frame_bits, uint32_t latency_budget_us,
+                           uint32_t fifo_size, uart_coalesce_config_t *config);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* UART_COALESCE_H_ */
+
+/* [] END OF FILE */
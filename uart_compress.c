@@ -0,0 +1,483 @@
+/******************************************************************************
+* File Name:   uart_compress.c
+*
+* Description: This file contains the LZSS stream compression of the TX data. Every
+*              block is compressed against the last UART_COMPRESS_WINDOW bytes of the
+*              stream; groups of 8 items follow a control byte, an item is either a
+*              literal byte or a 2-byte match. A block that does not shrink is
+*              stored. The codec has no dependencies and also builds on the host
+*              (UART_COMPRESS_HOST_BUILD).
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#include "uart_compress.h"
+
+#if (UART_COMPRESS_BLOCK_SIZE > UART_COMPRESS_LENGTH_Msk)
+#error "UART_COMPRESS_BLOCK_SIZE exceeds the block header"
+#endif
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+#define UART_COMPRESS_WINDOW_Msk        (UART_COMPRESS_WINDOW - 1U)
+
+/* Decompressor states */
+#define UART_DECOMPRESS_HEADER_LOW      0U
+#define UART_DECOMPRESS_HEADER_HIGH     1U
+#define UART_DECOMPRESS_STORED          2U
+#define UART_DECOMPRESS_CONTROL         3U
+#define UART_DECOMPRESS_ITEM            4U
+#define UART_DECOMPRESS_MATCH           5U
+
+/*******************************************************************************
+* Function Name: uart_compress_init
+********************************************************************************
+* Summary:
+* Starts a new stream, the first block tells the decompressor to reset.
+*
+* Parameters:
+*  compress: Compressor state
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void uart_compress_init(uart_compress_t *compress)
+{
+    compress->position = 0U;
+    compress->reset = true;
+}
+
+/*******************************************************************************
+* Function Name: uart_compress_match
+********************************************************************************
+* Summary:
+* Finds the longest match for the data at index in the history and in the
+* data before index. Bytes at a distance shorter than the match repeat
+* within the match.
+*
+* Parameters:
+*  compress: Compressor state, the window holds the bytes before index
+*  data:     Block data
+*  index:    Position in the block
+*  length:   Block length
+*  distance: Distance of the match
+*
+* Return:
+*  uint32_t: Match length, 0 if shorter than UART_COMPRESS_MIN_MATCH
+*
+*******************************************************************************/
+static uint32_t uart_compress_match(const uart_compress_t *compress, const uint8_t *data,
+                                    uint32_t index, uint32_t length, uint32_t *distance)
+{
+    uint32_t history = (compress->position < UART_COMPRESS_WINDOW) ? compress->position : UART_COMPRESS_WINDOW;
+    uint32_t max = length - index;
+    uint32_t best = 0U;
+
+    if (max > UART_COMPRESS_MAX_MATCH)
+    {
+        max = UART_COMPRESS_MAX_MATCH;
+    }
+    if (max < UART_COMPRESS_MIN_MATCH)
+    {
+        return 0U;
+    }
+
+    for (uint32_t d = 1U; d <= history; d++)
+    {
+        uint32_t n = 0U;
+
+        while (n < max)
+        {
+            uint8_t source = (n < d) ? compress->window[(compress->position - d + n) & UART_COMPRESS_WINDOW_Msk]
+                                     : data[index + n - d];
+
+            if (source != data[index + n])
+            {
+                break;
+            }
+            n++;
+        }
+        if (n > best)
+        {
+            best = n;
+            *distance = d;
+            if (n == max)
+            {
+                break;
+            }
+        }
+    }
+
+    return (best >= UART_COMPRESS_MIN_MATCH) ? best : 0U;
+}
+
+/*******************************************************************************
+* Function Name: uart_compress_block
+********************************************************************************
+* Summary:
+* Compresses one block. The search tries every distance of the window, so
+* the cost per byte grows linearly with UART_COMPRESS_WINDOW.
+*
+* Parameters:
+*  compress: Compressor state
+*  data:     Block data
+*  length:   Block length, 1 to UART_COMPRESS_BLOCK_SIZE
+*  block:    Output of UART_COMPRESS_BOUND(length) bytes
+*
+* Return:
+*  uint32_t: Size of the block written
+*
+*******************************************************************************/
+uint32_t uart_compress_block(uart_compress_t *compress, const uint8_t *data, uint32_t length,
+                             uint8_t *block)
+{
+    uint32_t header = compress->reset ? UART_COMPRESS_RESET : 0U;
+    uint32_t size = UART_COMPRESS_HEADER_SIZE;
+    uint32_t control = 0U;
+    uint32_t item = 8U;
+    uint32_t index = 0U;
+
+    if (compress->reset)
+    {
+        compress->position = 0U;
+        compress->reset = false;
+    }
+
+    /* Stop as soon as the compressed data is not shorter than the input */
+    while ((index < length) && ((size - UART_COMPRESS_HEADER_SIZE) < length))
+    {
+        uint32_t distance = 0U;
+        uint32_t match = uart_compress_match(compress, data, index, length, &distance);
+        uint32_t count = (match != 0U) ? match : 1U;
+
+        if (item == 8U)
+        {
+            control = size++;
+            block[control] = 0U;
+            item = 0U;
+        }
+        if (match != 0U)
+        {
+            block[control] |= (uint8_t)(1U << item);
+            block[size++] = (uint8_t)(distance - 1U);
+            block[size++] = (uint8_t)((((distance - 1U) >> 8) << 4) | (match - UART_COMPRESS_MIN_MATCH));
+        }
+        else
+        {
+            block[size++] = data[index];
+        }
+        item++;
+
+        for (uint32_t i = 0U; i < count; i++)
+        {
+            compress->window[compress->position++ & UART_COMPRESS_WINDOW_Msk] = data[index++];
+        }
+    }
+
+    if ((index < length) || ((size - UART_COMPRESS_HEADER_SIZE) >= length))
+    {
+        /* Store the block, the history still takes all of its bytes */
+        while (index < length)
+        {
+            compress->window[compress->position++ & UART_COMPRESS_WINDOW_Msk] = data[index++];
+        }
+        for (index = 0U; index < length; index++)
+        {
+            block[UART_COMPRESS_HEADER_SIZE + index] = data[index];
+        }
+        header |= UART_COMPRESS_STORED;
+        size = UART_COMPRESS_HEADER_SIZE + length;
+    }
+
+    header |= size - UART_COMPRESS_HEADER_SIZE;
+    block[0] = (uint8_t)header;
+    block[1] = (uint8_t)(header >> 8);
+
+    return size;
+}
+
+/*******************************************************************************
+* Function Name: uart_decompress_init
+********************************************************************************
+* Summary:
+* Prepares the decompressor for a new stream.
+*
+* Parameters:
+*  decompress: Decompressor state
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void uart_decompress_init(uart_decompress_t *decompress)
+{
+    decompress->position = 0U;
+    decompress->copy_length = 0U;
+    decompress->state = UART_DECOMPRESS_HEADER_LOW;
+}
+
+/*******************************************************************************
+* Function Name: uart_decompress_output
+********************************************************************************
+* Summary:
+* Appends a decompressed byte to the history.
+*
+* Parameters:
+*  decompress: Decompressor state
+*  value:      Decompressed byte
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static inline void uart_decompress_output(uart_decompress_t *decompress, uint8_t value)
+{
+    decompress->window[decompress->position++ & UART_COMPRESS_WINDOW_Msk] = value;
+}
+
+/*******************************************************************************
+* Function Name: uart_decompress
+********************************************************************************
+* Summary:
+* Decompresses a piece of the received stream. The input can be split at any
+* byte; the state is kept between calls. Input is consumed only while there
+* is room in the output.
+*
+* Parameters:
+*  decompress: Decompressor state
+*  data:       Received bytes
+*  length:     Number of received bytes
+*  consumed:   Received bytes used
+*  output:     Decompressed data
+*  size:       Room in the output
+*
+* Return:
+*  uint32_t: Decompressed bytes written
+*
+*******************************************************************************/
+uint32_t uart_decompress(uart_decompress_t *decompress, const uint8_t *data, uint32_t length,
+                         uint32_t *consumed, uint8_t *output, uint32_t size)
+{
+    uint32_t produced = 0U;
+    uint32_t used = 0U;
+
+    for (;;)
+    {
+        uint8_t value;
+
+        /* Finish the match being copied first */
+        while ((decompress->copy_length != 0U) && (produced < size))
+        {
+            value = decompress->window[(decompress->position - decompress->copy_distance) &
+                                      UART_COMPRESS_WINDOW_Msk];
+            uart_decompress_output(decompress, value);
+            output[produced++] = value;
+            decompress->copy_length--;
+        }
+        if ((used == length) || (produced == size))
+        {
+            break;
+        }
+
+        value = data[used++];
+        switch (decompress->state)
+        {
+            case UART_DECOMPRESS_HEADER_LOW:
+                decompress->header = value;
+                decompress->state = UART_DECOMPRESS_HEADER_HIGH;
+                continue;
+
+            case UART_DECOMPRESS_HEADER_HIGH:
+                decompress->header |= (uint16_t)(value << 8);
+                decompress->remaining = decompress->header & UART_COMPRESS_LENGTH_Msk;
+                if ((decompress->header & UART_COMPRESS_RESET) != 0U)
+                {
+                    decompress->position = 0U;
+                }
+                decompress->state = ((decompress->header & UART_COMPRESS_STORED) != 0U) ?
+                                    UART_DECOMPRESS_STORED : UART_DECOMPRESS_CONTROL;
+                if (decompress->remaining == 0U)
+                {
+                    decompress->state = UART_DECOMPRESS_HEADER_LOW;
+                }
+                continue;
+
+            case UART_DECOMPRESS_STORED:
+                uart_decompress_output(decompress, value);
+                output[produced++] = value;
+                break;
+
+            case UART_DECOMPRESS_CONTROL:
+                decompress->control = value;
+                decompress->items = 8U;
+                decompress->state = UART_DECOMPRESS_ITEM;
+                break;
+
+            case UART_DECOMPRESS_ITEM:
+                if ((decompress->control & 1U) != 0U)
+                {
+                    decompress->match = value;
+                    decompress->state = UART_DECOMPRESS_MATCH;
+                }
+                else
+                {
+                    uart_decompress_output(decompress, value);
+                    output[produced++] = value;
+                    decompress->items--;
+                }
+                decompress->control >>= 1;
+                break;
+
+            default:
+                decompress->copy_distance = ((uint32_t)decompress->match | ((uint32_t)(value >> 4) << 8)) + 1U;
+                decompress->copy_length = (value & 0x0FU) + UART_COMPRESS_MIN_MATCH;
+                decompress->state = UART_DECOMPRESS_ITEM;
+                decompress->items--;
+                break;
+        }
+
+        /* Next block, next group or next item */
+        if (--decompress->remaining == 0U)
+        {
+            decompress->state = UART_DECOMPRESS_HEADER_LOW;
+        }
+        else if ((decompress->state == UART_DECOMPRESS_ITEM) && (decompress->items == 0U))
+        {
+            decompress->state = UART_DECOMPRESS_CONTROL;
+        }
+    }
+
+    *consumed = used;
+    return produced;
+}
+
+#if !defined(UART_COMPRESS_HOST_BUILD) && (UART_COMPRESS_ENABLE == 1)
+
+#if defined(COMPONENT_FREERTOS)
+#error "The compressed TX stream sends through the asynchronous API, which is not built with FreeRTOS"
+#endif
+/*******************************************************************************
+*  Global Variables
+*******************************************************************************/
+uart_compress_stats_t uart_compress_stats;
+uart_decompress_t uart_compress_rx;
+
+static uart_compress_t compress_tx = { .reset = true };
+static uint8_t compress_block[UART_COMPRESS_BOUND(UART_COMPRESS_BLOCK_SIZE)];
+static volatile bool compress_busy;
+static const uint8_t *compress_buffer;
+static uint32_t compress_length;
+static uart_async_callback_t compress_callback;
+
+/*******************************************************************************
+* Function Name: uart_compress_tx_done
+********************************************************************************
+* Summary:
+* Write completion callback of a compressed block, called from PendSV. Frees
+* the block buffer and completes the request of the caller.
+*
+* Parameters:
+*  buffer: Sent block
+*  length: Size of the block
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void uart_compress_tx_done(const uint8_t *buffer, uint32_t length)
+{
+    (void)buffer;
+    (void)length;
+
+    compress_busy = false;
+    if (compress_callback != NULL)
+    {
+        compress_callback(compress_buffer, compress_length);
+    }
+}
+
+/*******************************************************************************
+* Function Name: uart_compress_tx_async
+********************************************************************************
+* Summary:
+* Compresses a block and queues it as bulk data. One block is in flight at a
+* time. If the block cannot be queued, the history is restarted so that the
+* peer stays in step once the caller retries.
+*
+* Parameters:
+*  buffer:   Data to send
+*  length:   Number of bytes, 1 to UART_COMPRESS_BLOCK_SIZE
+*  callback: Called from PendSV when the block has been sent, may be NULL
+*
+* Return:
+*  uart_async_status_t
+*
+*******************************************************************************/
+uart_async_status_t uart_compress_tx_async(const uint8_t *buffer, uint32_t length,
+                                           uart_async_callback_t callback)
+{
+    uint32_t size;
+
+    if ((buffer == NULL) || (length == 0U) || (length > UART_COMPRESS_BLOCK_SIZE))
+    {
+        return UART_ASYNC_INVALID;
+    }
+    if (compress_busy)
+    {
+        return UART_ASYNC_QUEUE_FULL;
+    }
+
+    size = uart_compress_block(&compress_tx, buffer, length, compress_block);
+    compress_buffer = buffer;
+    compress_length = length;
+    compress_callback = callback;
+
+    /* The callback may run before the request function returns */
+    compress_busy = true;
+    if (uart_tx_async(compress_block, size, uart_compress_tx_done) != UART_ASYNC_SUCCESS)
+    {
+        compress_busy = false;
+        uart_compress_init(&compress_tx);
+        return UART_ASYNC_QUEUE_FULL;
+    }
+
+    uart_compress_stats.raw_bytes += length;
+    uart_compress_stats.sent_bytes += size;
+
+    return UART_ASYNC_SUCCESS;
+}
+#endif
+
+/* [] END OF FILE */
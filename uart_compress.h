@@ -0,0 +1,149 @@
+/******************************************************************************
+* File Name:   uart_compress.h
+*
+* Description: This file contains the interface of the LZSS stream compression of
+*              the TX data and the matching decompressor. The codec has no
+*              dependencies and also builds on the host (UART_COMPRESS_HOST_BUILD).
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#ifndef UART_COMPRESS_H_
+#define UART_COMPRESS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "uart_config.h"
+
+#if !defined(UART_COMPRESS_HOST_BUILD)
+#include "uart_async.h"
+#endif
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+/* History searched for matches (power of two, 16 to 4096 bytes). Both ends
+ * of the link must use the same window.
+ */
+#ifndef UART_COMPRESS_WINDOW
+#define UART_COMPRESS_WINDOW            256U
+#endif
+
+/* Largest block, the unit passed to uart_compress_tx_async() */
+#ifndef UART_COMPRESS_BLOCK_SIZE
+#define UART_COMPRESS_BLOCK_SIZE        256U
+#endif
+
+/* Match length range, a match is coded in 2 bytes: 12-bit distance - 1 and
+ * 4-bit length - 3
+ */
+#define UART_COMPRESS_MIN_MATCH         3U
+#define UART_COMPRESS_MAX_MATCH         18U
+
+/* Block header: 14-bit length of the block data, flags in the upper bits */
+#define UART_COMPRESS_HEADER_SIZE       2U
+#define UART_COMPRESS_LENGTH_Msk        0x3FFFU
+#define UART_COMPRESS_RESET             0x4000U     /* History starts empty */
+#define UART_COMPRESS_STORED            0x8000U     /* Data is stored uncompressed */
+
+/* Compressed size of a block of length bytes, worst case */
+#define UART_COMPRESS_BOUND(length)     ((length) + UART_COMPRESS_HEADER_SIZE + 2U)
+
+#if ((UART_COMPRESS_WINDOW & (UART_COMPRESS_WINDOW - 1U)) != 0U) || \
+    (UART_COMPRESS_WINDOW < 16U) || (UART_COMPRESS_WINDOW > 4096U)
+#error "UART_COMPRESS_WINDOW must be a power of two from 16 to 4096"
+#endif
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+typedef struct
+{
+    uint8_t window[UART_COMPRESS_WINDOW];   /* Last bytes of the stream */
+    uint32_t position;                      /* Bytes since the last reset */
+    bool reset;                             /* Next block starts a new history */
+} uart_compress_t;
+
+typedef struct
+{
+    uint8_t window[UART_COMPRESS_WINDOW];   /* Last bytes of the stream */
+    uint32_t position;                      /* Bytes since the last reset */
+    uint32_t remaining;                     /* Block data bytes not yet read */
+    uint32_t copy_distance;                 /* Match being copied */
+    uint32_t copy_length;
+    uint16_t header;
+    uint8_t state;
+    uint8_t control;                        /* Item flags, 1 = match */
+    uint8_t items;                          /* Items left in the group */
+    uint8_t match;                          /* First byte of a match */
+} uart_decompress_t;
+
+typedef struct
+{
+    uint32_t raw_bytes;         /* Bytes passed to uart_compress_tx_async() */
+    uint32_t sent_bytes;        /* Bytes queued after compression */
+} uart_compress_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void uart_compress_init(uart_compress_t *compress);
+uint32_t uart_compress_block(uart_compress_t *compress, const uint8_t *data, uint32_t length,
+                             uint8_t *block);
+void uart_decompress_init(uart_decompress_t *decompress);
+uint32_t uart_decompress(uart_decompress_t *decompress, const uint8_t *data, uint32_t length,
+                         uint32_t *consumed, uint8_t *output, uint32_t size);
+
+#if !defined(UART_COMPRESS_HOST_BUILD) && (UART_COMPRESS_ENABLE == 1)
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+extern uart_compress_stats_t uart_compress_stats;
+extern uart_decompress_t uart_compress_rx;
+
+uart_async_status_t uart_compress_tx_async(const uint8_t *buffer, uint32_t length,
+                                           uart_async_callback_t callback);
+#endif
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* UART_COMPRESS_H_ */
+
+/* [] END OF FILE */
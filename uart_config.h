@@ -0,0 +1,315 @@
+/******************************************************************************
+* File Name:   uart_config.h
+*
+* Description: This file contains the compile-time configuration of the UART
+*              driver and the example. Every option can be overridden with the
+*              DEFINES variable in the Makefile.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#ifndef UART_CONFIG_H_
+#define UART_CONFIG_H_
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+/* Baud rate configured in design.modus */
+#define UART_BAUDRATE                   9600U
+
+/* TX and RX FIFO size configured in design.modus */
+#define UART_FIFO_SIZE                  8U
+
+/* TX and RX FIFO data pointers configured in design.modus */
+#define UART_TX_FIFO_POINTER            0U
+#define UART_RX_FIFO_POINTER            8U
+
+/* TX and RX FIFO sizes in words programmed at start-up, a power of two from
+ * 2 to 64. The buffers are allocated from the 64 words of USIC0 FIFO RAM.
+ */
+#ifndef UART_TX_FIFO_SIZE
+#define UART_TX_FIFO_SIZE               UART_FIFO_SIZE
+#endif
+
+#ifndef UART_RX_FIFO_SIZE
+#define UART_RX_FIFO_SIZE               UART_FIFO_SIZE
+#endif
+
+/* Build profile with the smallest driver RAM (1 = enabled): one TX priority,
+ * two requests per queue, and short trace, timestamp and soak buffers
+ */
+#ifndef UART_MINIMAL_RAM
+#define UART_MINIMAL_RAM                0
+#endif
+
+#if (UART_MINIMAL_RAM == 1)
+#ifndef UART_ASYNC_QUEUE_DEPTH
+#define UART_ASYNC_QUEUE_DEPTH          2U
+#endif
+#ifndef UART_ASYNC_TX_PRIORITIES
+#define UART_ASYNC_TX_PRIORITIES        1U
+#endif
+#ifndef UART_RX_TIMESTAMP_DEPTH
+#define UART_RX_TIMESTAMP_DEPTH         8U
+#endif
+#ifndef UART_TRACE_DEPTH
+#define UART_TRACE_DEPTH                16U
+#endif
+#ifndef UART_SOAK_MAX_LENGTH
+#define UART_SOAK_MAX_LENGTH            16U
+#endif
+#ifndef UART_PINGPONG_LENGTH
+#define UART_PINGPONG_LENGTH            16U
+#endif
+#ifndef UART_SELFTEST_LENGTH
+#define UART_SELFTEST_LENGTH            32U
+#endif
+#ifndef UART_LOG_DEPTH
+#define UART_LOG_DEPTH                  8U
+#endif
+#ifndef UART_COMPRESS_WINDOW
+#define UART_COMPRESS_WINDOW            64U
+#endif
+#ifndef UART_COMPRESS_BLOCK_SIZE
+#define UART_COMPRESS_BLOCK_SIZE        64U
+#endif
+#ifndef UART_CIPHER_BUFFER
+#define UART_CIPHER_BUFFER              64U
+#endif
+#endif
+
+/* Baud rate programmed at start-up by the baud rate solver (0 = keep
+ * UART_BAUDRATE from design.modus). Up to fPERIPH / 4 can be reached.
+ */
+#ifndef UART_RUNTIME_BAUDRATE
+#define UART_RUNTIME_BAUDRATE           0U
+#endif
+
+/* Detect the baud rate from a sync character (0x55) at start-up (1 = enabled) */
+#ifndef UART_AUTOBAUD_ENABLE
+#define UART_AUTOBAUD_ENABLE            0
+#endif
+
+/* Polling iterations to wait for the sync character */
+#ifndef UART_AUTOBAUD_TIMEOUT
+#define UART_AUTOBAUD_TIMEOUT           0x400000U
+#endif
+
+/* Run the self-test through the USIC internal loopback at start-up, then
+ * switch to the RX pin (1 = enabled)
+ */
+#ifndef UART_SELFTEST_ENABLE
+#define UART_SELFTEST_ENABLE            0
+#endif
+
+/* Maximum RX latency in microseconds that interrupt coalescing may add
+ * (0 = disabled, the FIFO limits from design.modus are used)
+ */
+#ifndef UART_COALESCE_LATENCY_US
+#define UART_COALESCE_LATENCY_US        0U
+#endif
+
+/* CCU4 slice of the coalescing fallback timer, its service request, and the
+ * interrupt and handler of that service request. Define all of them to move
+ * the timer; slice 3 of CCU40 is the XMC1 RX timestamp timer.
+ */
+#ifndef UART_COALESCE_CCU4_SLICE
+#define UART_COALESCE_CCU4_MODULE       CCU40
+#define UART_COALESCE_CCU4_SLICE        CCU40_CC42
+#define UART_COALESCE_CCU4_SLICE_NUM    2U
+#define UART_COALESCE_CCU4_SHADOW       XMC_CCU4_SHADOW_TRANSFER_SLICE_2
+#define UART_COALESCE_CCU4_SR           XMC_CCU4_SLICE_SR_ID_0
+#define UART_COALESCE_TIMER_IRQn        CCU40_0_IRQn
+#define UART_COALESCE_TIMER_HANDLER     CCU40_0_IRQHandler
+#endif
+
+/* Priority of the coalescing fallback timer interrupt */
+#ifndef UART_COALESCE_TIMER_PRIORITY
+#define UART_COALESCE_TIMER_PRIORITY    63
+#endif
+
+/* Serve TX refill and RX drain in one handler on USIC0_0_IRQn (1 = enabled) */
+#ifndef UART_COMBINED_IRQ_ENABLE
+#define UART_COMBINED_IRQ_ENABLE        0
+#endif
+
+/* Measure the FIFO interrupts including exception entry, tail-chaining and
+ * exit at start-up (1 = enabled)
+ */
+#ifndef UART_IRQ_BENCHMARK
+#define UART_IRQ_BENCHMARK              0
+#endif
+
+/* Drain the RX FIFO byte by byte with XMC_USIC_CH_RXFIFO_IsEmpty() and
+ * XMC_UART_CH_GetReceivedData() instead of in batches sized by the FIFO level,
+ * to compare both (1 = per byte)
+ */
+#ifndef UART_RX_DRAIN_PER_BYTE
+#define UART_RX_DRAIN_PER_BYTE          0
+#endif
+
+/* Maximum bytes moved per FIFO interrupt entry, bounding the handler runtime
+ * (0 = unbounded, the FIFO is refilled and drained completely)
+ */
+#ifndef UART_ISR_MAX_BYTES
+#define UART_ISR_MAX_BYTES              0U
+#endif
+
+/* Record a timestamp for every RX FIFO drain (1 = enabled) */
+#ifndef UART_RX_TIMESTAMP_ENABLE
+#define UART_RX_TIMESTAMP_ENABLE        0
+#endif
+
+/* Number of RX FIFO drains kept in the timestamp ring (power of two) */
+#ifndef UART_RX_TIMESTAMP_DEPTH
+#define UART_RX_TIMESTAMP_DEPTH         32U
+#endif
+
+/* Log driver events into the binary trace buffer (1 = enabled) */
+#ifndef UART_TRACE_ENABLE
+#define UART_TRACE_ENABLE               0
+#endif
+
+/* Number of records in the trace buffer (power of two, 8 bytes each) */
+#ifndef UART_TRACE_DEPTH
+#define UART_TRACE_DEPTH                128U
+#endif
+
+/* CPU cycles a UART_TRACE() call may take, a slower one is flagged at start-up */
+#ifndef UART_TRACE_BUDGET_CYCLES
+#define UART_TRACE_BUDGET_CYCLES        20U
+#endif
+
+/* Reply to the stats command byte with the performance counters (1 = enabled) */
+#ifndef UART_STATS_CMD_ENABLE
+#define UART_STATS_CMD_ENABLE           0
+#endif
+
+/* Escape byte of the stats command, doubled when it occurs in the data */
+#ifndef UART_STATS_CMD_BYTE
+#define UART_STATS_CMD_BYTE             0xF5U
+#endif
+
+/* Byte after the escape requesting a stats reply */
+#ifndef UART_STATS_CMD_REQUEST
+#define UART_STATS_CMD_REQUEST          0x53U
+#endif
+
+/* Deferred log over the debug UART, see uart_log_formats.h (1 = enabled) */
+#ifndef UART_LOG_ENABLE
+#define UART_LOG_ENABLE                 0
+#endif
+
+/* Number of records in the log ring (power of two, 20 bytes each) */
+#ifndef UART_LOG_DEPTH
+#define UART_LOG_DEPTH                  32U
+#endif
+
+/* Send binary frames for tools/uart_log_decode.c instead of text lines
+ * (1 = binary)
+ */
+#ifndef UART_LOG_BINARY
+#define UART_LOG_BINARY                 0
+#endif
+
+/* Bytes sent per log batch */
+#ifndef UART_LOG_TX_SIZE
+#define UART_LOG_TX_SIZE                128U
+#endif
+
+/* LZSS compression in front of the TX queue, see uart_compress.h (1 = enabled) */
+#ifndef UART_COMPRESS_ENABLE
+#define UART_COMPRESS_ENABLE            0
+#endif
+
+/* ChaCha20 encryption of both directions, see uart_cipher.h (1 = enabled) */
+#ifndef UART_CIPHER_ENABLE
+#define UART_CIPHER_ENABLE              0
+#endif
+
+/* CRC-16 of every write and read, computed by the FIFO interrupts, see
+ * uart_crc.h (1 = enabled)
+ */
+#ifndef UART_CRC_ENABLE
+#define UART_CRC_ENABLE                 0
+#endif
+
+/* Place the CRC table in data SRAM instead of flash (1 = SRAM) */
+#ifndef UART_CRC_TABLE_SRAM
+#define UART_CRC_TABLE_SRAM             1
+#endif
+
+/* Measure the RX drain with the CRC table in flash and in SRAM at start-up
+ * (1 = enabled)
+ */
+#ifndef UART_CRC_BENCHMARK
+#define UART_CRC_BENCHMARK              0
+#endif
+
+/* Capture the parity error flag of every received byte into a bit-packed
+ * map, see uart_rx_status.h (1 = enabled)
+ */
+#ifndef UART_RX_STATUS_ENABLE
+#define UART_RX_STATUS_ENABLE           0
+#endif
+
+/* Loop pseudo-random frames through TX, RX and verify forever (1 = enabled) */
+#ifndef UART_SOAK_ENABLE
+#define UART_SOAK_ENABLE                0
+#endif
+
+/* Stream PRBS test data through TX and RX forever (1 = enabled) */
+#ifndef UART_PRBS_ENABLE
+#define UART_PRBS_ENABLE                0
+#endif
+
+/* Stream a counter sequence into double-buffered RX and process it with a
+ * slow consumer forever (1 = enabled)
+ */
+#ifndef UART_PINGPONG_ENABLE
+#define UART_PINGPONG_ENABLE            0
+#endif
+
+/* Set interrupt priority for the USIC0_0_IRQn */
+#ifndef USIC0_0_IRQn_PRIORITY
+#define USIC0_0_IRQn_PRIORITY           63
+#endif
+
+/* Set interrupt priority for the USIC0_1_IRQn */
+#ifndef USIC0_1_IRQn_PRIORITY
+#define USIC0_1_IRQn_PRIORITY           62
+#endif
+
+#endif /* UART_CONFIG_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,159 @@
+/******************************************************************************
+* File Name:   uart_crc.c
+*
+* Description: This file contains the CRC-16 lookup table of the FIFO interrupts and a
+*              benchmark of its placement in flash and in SRAM.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#include "uart_crc.h"
+
+#if (UART_CRC_BENCHMARK == 1)
+#include "uart_cycles.h"
+#endif
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+/* Bytes drained per benchmark measurement */
+#define UART_CRC_BENCHMARK_BYTES        1024U
+
+/*******************************************************************************
+*  Global Variables
+*******************************************************************************/
+UART_CRC_TABLE_CONST uint16_t uart_crc_table[256] UART_CRC_TABLE_SECTION = { UART_CRC_TABLE };
+
+#if (UART_CRC_BENCHMARK == 1)
+/* Copy of the table in the other placement */
+#if (UART_CRC_TABLE_SRAM == 1)
+static const uint16_t crc_table_flash[256] = { UART_CRC_TABLE };
+#define UART_CRC_FLASH_TABLE            crc_table_flash
+#define UART_CRC_SRAM_TABLE             uart_crc_table
+#else
+static uint16_t crc_table_sram[256] __attribute__((section(".data.uart_crc_table"))) = { UART_CRC_TABLE };
+#define UART_CRC_FLASH_TABLE            uart_crc_table
+#define UART_CRC_SRAM_TABLE             crc_table_sram
+#endif
+
+/* Stand-in for the RX buffer register and the read buffer */
+static volatile uint8_t crc_source;
+static uint8_t crc_sink[UART_CRC_BENCHMARK_BYTES];
+#endif
+
+/*******************************************************************************
+* Function Name: uart_crc_compute
+********************************************************************************
+* Summary:
+* Adds a buffer to a CRC.
+*
+* Parameters:
+*  crc:    CRC so far, UART_CRC_INIT at the start
+*  data:   Data
+*  length: Number of bytes
+*
+* Return:
+*  uint16_t
+*
+*******************************************************************************/
+uint16_t uart_crc_compute(uint16_t crc, const uint8_t *data, uint32_t length)
+{
+    for (uint32_t i = 0U; i < length; i++)
+    {
+        crc = uart_crc_update(crc, data[i]);
+    }
+
+    return crc;
+}
+
+#if (UART_CRC_BENCHMARK == 1)
+/*******************************************************************************
+* Function Name: uart_crc_drain
+********************************************************************************
+* Summary:
+* The per-byte work of the RX drain with the CRC: read the data register,
+* update the CRC and store the byte. Not inlined, so that both placements
+* run the same code.
+*
+* Parameters:
+*  table: CRC table
+*
+* Return:
+*  uint32_t: CPU cycles for UART_CRC_BENCHMARK_BYTES bytes
+*
+*******************************************************************************/
+static uint32_t __attribute__((noinline)) uart_crc_drain(const uint16_t *table)
+{
+    uint16_t crc = UART_CRC_INIT;
+    uint32_t start = uart_cycles_now();
+
+    for (uint32_t i = 0U; i < UART_CRC_BENCHMARK_BYTES; i++)
+    {
+        uint8_t data = crc_source;
+
+        crc = (uint16_t)((uint32_t)crc << 8) ^ table[(uint8_t)((crc >> 8) ^ data)];
+        crc_sink[i] = data;
+        crc_source = (uint8_t)crc;
+    }
+
+    return uart_cycles_elapsed(start);
+}
+
+/*******************************************************************************
+* Function Name: uart_crc_benchmark
+********************************************************************************
+* Summary:
+* Measures the RX drain cycles per byte with the CRC table in flash and in
+* SRAM. Each placement is measured twice and the second run is kept, so
+* that both see the same flash cache and prefetch state.
+*
+* Parameters:
+*  result: Cycles per UART_CRC_BENCHMARK_BYTES bytes for each placement
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void uart_crc_benchmark(uart_crc_benchmark_t *result)
+{
+    uart_cycles_init();
+
+    result->bytes = UART_CRC_BENCHMARK_BYTES;
+    (void)uart_crc_drain(UART_CRC_FLASH_TABLE);
+    result->flash_cycles = uart_crc_drain(UART_CRC_FLASH_TABLE);
+    (void)uart_crc_drain(UART_CRC_SRAM_TABLE);
+    result->sram_cycles = uart_crc_drain(UART_CRC_SRAM_TABLE);
+}
+#endif
+
+/* [] END OF FILE */
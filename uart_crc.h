@@ -0,0 +1,148 @@
+/******************************************************************************
+* File Name:   uart_crc.h
+*
+* Description: This file contains the interface of the CRC-16 computed on the fly by the
+*              FIFO interrupts. The lookup table is generated at compile time and placed
+*              in data SRAM or flash.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#ifndef UART_CRC_H_
+#define UART_CRC_H_
+
+#include <stdint.h>
+#include "uart_config.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+/* CRC-16/CCITT-FALSE: polynomial 0x1021, initial value 0xFFFF, no reflection */
+#define UART_CRC_POLYNOMIAL             0x1021U
+#define UART_CRC_INIT                   0xFFFFU
+
+/* The table is built by the preprocessor, the C counterpart of a constexpr
+ * function. Each entry is linear in its index, so it is the XOR of the
+ * entries of its set bits, which are the index bit shifted through eight
+ * CRC steps.
+ */
+#define UART_CRC_STEP(crc)              (((uint32_t)(crc) << 1) ^ ((((uint32_t)(crc) & 0x8000U) != 0U) ? \
+                                         UART_CRC_POLYNOMIAL : 0U))
+#define UART_CRC_STEP8(crc)             UART_CRC_STEP(UART_CRC_STEP(UART_CRC_STEP(UART_CRC_STEP( \
+                                        UART_CRC_STEP(UART_CRC_STEP(UART_CRC_STEP(UART_CRC_STEP(crc))))))))
+#define UART_CRC_BIT(bit, n)            ((((uint32_t)(n) & (1UL << (bit))) != 0U) ? \
+                                         (UART_CRC_STEP8(1UL << ((bit) + 8U)) & 0xFFFFU) : 0U)
+#define UART_CRC_ENTRY(n)               (uint16_t)(UART_CRC_BIT(0U, n) ^ UART_CRC_BIT(1U, n) ^ \
+                                                   UART_CRC_BIT(2U, n) ^ UART_CRC_BIT(3U, n) ^ \
+                                                   UART_CRC_BIT(4U, n) ^ UART_CRC_BIT(5U, n) ^ \
+                                                   UART_CRC_BIT(6U, n) ^ UART_CRC_BIT(7U, n))
+#define UART_CRC_ROW(n)                 UART_CRC_ENTRY((n) + 0U), UART_CRC_ENTRY((n) + 1U), \
+                                        UART_CRC_ENTRY((n) + 2U), UART_CRC_ENTRY((n) + 3U), \
+                                        UART_CRC_ENTRY((n) + 4U), UART_CRC_ENTRY((n) + 5U), \
+                                        UART_CRC_ENTRY((n) + 6U), UART_CRC_ENTRY((n) + 7U)
+#define UART_CRC_TABLE                  UART_CRC_ROW(0U),   UART_CRC_ROW(8U),   UART_CRC_ROW(16U),  UART_CRC_ROW(24U),  \
+                                        UART_CRC_ROW(32U),  UART_CRC_ROW(40U),  UART_CRC_ROW(48U),  UART_CRC_ROW(56U),  \
+                                        UART_CRC_ROW(64U),  UART_CRC_ROW(72U),  UART_CRC_ROW(80U),  UART_CRC_ROW(88U),  \
+                                        UART_CRC_ROW(96U),  UART_CRC_ROW(104U), UART_CRC_ROW(112U), UART_CRC_ROW(120U), \
+                                        UART_CRC_ROW(128U), UART_CRC_ROW(136U), UART_CRC_ROW(144U), UART_CRC_ROW(152U), \
+                                        UART_CRC_ROW(160U), UART_CRC_ROW(168U), UART_CRC_ROW(176U), UART_CRC_ROW(184U), \
+                                        UART_CRC_ROW(192U), UART_CRC_ROW(200U), UART_CRC_ROW(208U), UART_CRC_ROW(216U), \
+                                        UART_CRC_ROW(224U), UART_CRC_ROW(232U), UART_CRC_ROW(240U), UART_CRC_ROW(248U)
+
+/* Table placement. In SRAM the table is initialized data in its own input
+ * section, copied from flash by the start-up code. The XMC4 linker scripts
+ * put .data* in the SRAM following PSRAM, both read without the flash wait
+ * states; a BSP linker script can map .data.uart_crc_table to DSRAM1 so that
+ * table reads run on the system bus in parallel to instruction fetches.
+ */
+#if (UART_CRC_TABLE_SRAM == 1)
+#define UART_CRC_TABLE_CONST
+#define UART_CRC_TABLE_SECTION          __attribute__((section(".data.uart_crc_table")))
+#else
+#define UART_CRC_TABLE_CONST            const
+#define UART_CRC_TABLE_SECTION
+#endif
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+typedef struct
+{
+    uint32_t bytes;             /* Bytes per measurement */
+    uint32_t flash_cycles;      /* Drain cycles with the table in flash */
+    uint32_t sram_cycles;       /* Drain cycles with the table in SRAM */
+} uart_crc_benchmark_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+extern UART_CRC_TABLE_CONST uint16_t uart_crc_table[256];
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+uint16_t uart_crc_compute(uint16_t crc, const uint8_t *data, uint32_t length);
+#if (UART_CRC_BENCHMARK == 1)
+void uart_crc_benchmark(uart_crc_benchmark_t *result);
+#endif
+
+/*******************************************************************************
+* Function Name: uart_crc_update
+********************************************************************************
+* Summary:
+* Adds one byte to a CRC: one table load, two shifts and two XORs.
+*
+* Parameters:
+*  crc:  CRC so far, UART_CRC_INIT at the start
+*  data: Byte
+*
+* Return:
+*  uint16_t
+*
+*******************************************************************************/
+static inline uint16_t uart_crc_update(uint16_t crc, uint8_t data)
+{
+    return (uint16_t)((uint32_t)crc << 8) ^ uart_crc_table[(uint8_t)((crc >> 8) ^ data)];
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* UART_CRC_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,153 @@
+/******************************************************************************
+* File Name:   uart_cycles.h
+*
+* Description: This file contains the cycle counter used to measure the interrupt
+*              handlers. XMC4 uses the DWT cycle counter, XMC1 (Cortex-M0 without
+*              DWT) uses the SysTick down counter.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#ifndef UART_CYCLES_H_
+#define UART_CYCLES_H_
+
+#include "xmc_common.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Function Name: uart_cycles_init
+********************************************************************************
+* Summary:
+* Starts the cycle counter. On XMC1 SysTick is started free-running without
+* interrupt unless it is already running; a SysTick period configured later is
+* taken into account by uart_cycles_elapsed().
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static inline void uart_cycles_init(void)
+{
+#if (UC_FAMILY == XMC4)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#else
+    if ((SysTick->CTRL & SysTick_CTRL_ENABLE_Msk) == 0U)
+    {
+        SysTick->LOAD = SysTick_LOAD_RELOAD_Msk;
+        SysTick->VAL = 0U;
+        SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+    }
+#endif
+}
+
+/*******************************************************************************
+* Function Name: uart_cycles_now
+********************************************************************************
+* Summary:
+* Returns the current cycle counter value.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: Counter value, only meaningful for uart_cycles_elapsed()
+*
+*******************************************************************************/
+static inline uint32_t uart_cycles_now(void)
+{
+#if (UC_FAMILY == XMC4)
+    return DWT->CYCCNT;
+#else
+    return SysTick->VAL;
+#endif
+}
+
+/*******************************************************************************
+* Function Name: uart_cycles_between
+********************************************************************************
+* Summary:
+* Returns the CPU cycles between two counter values. On XMC1 the interval must
+* be shorter than one SysTick period.
+*
+* Parameters:
+*  start: Earlier value returned by uart_cycles_now()
+*  end:   Later value returned by uart_cycles_now()
+*
+* Return:
+*  uint32_t: Cycles from start to end
+*
+*******************************************************************************/
+static inline uint32_t uart_cycles_between(uint32_t start, uint32_t end)
+{
+#if (UC_FAMILY == XMC4)
+    return end - start;
+#else
+    /* SysTick counts down and reloads from LOAD */
+    return (start >= end) ? (start - end) : (start + SysTick->LOAD + 1U - end);
+#endif
+}
+
+/*******************************************************************************
+* Function Name: uart_cycles_elapsed
+********************************************************************************
+* Summary:
+* Returns the CPU cycles since start. On XMC1 the measured interval must be
+* shorter than one SysTick period.
+*
+* Parameters:
+*  start: Value returned by uart_cycles_now()
+*
+* Return:
+*  uint32_t: Elapsed cycles
+*
+*******************************************************************************/
+static inline uint32_t uart_cycles_elapsed(uint32_t start)
+{
+    return uart_cycles_between(start, uart_cycles_now());
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* UART_CYCLES_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,1735 @@
+/******************************************************************************
+* File Name:   uart_fifo.c
+*
+* Description: This file contains the interrupt driven UART FIFO driver. The TX
+*              FIFO limit interrupt refills the TX FIFO from the write buffer and
+*              the RX FIFO limit interrupt drains the RX FIFO into the read buffer.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#include "cybsp.h"
+#include "xmc_uart.h"
+#include "cycfg_peripherals.h"
+#include "uart_fifo.h"
+#include "uart_cycles.h"
+#include "uart_fifo_ram.h"
+#include "uart_trace.h"
+#if (UART_PRBS_ENABLE == 1)
+#include "uart_prbs.h"
+#endif
+#if (UART_RX_TIMESTAMP_ENABLE == 1)
+#include "uart_timestamp.h"
+#endif
+#if (UART_CIPHER_ENABLE == 1)
+#include "uart_cipher.h"
+#endif
+#if (UART_CRC_ENABLE == 1)
+#include "uart_crc.h"
+#endif
+#if (UART_RX_STATUS_ENABLE == 1)
+#include "uart_rx_status.h"
+#endif
+#if (UART_COALESCE_LATENCY_US != 0U)
+#include "xmc_ccu4.h"
+#include "xmc_scu.h"
+#endif
+
+#if (UART_RX_DRAIN_PER_BYTE == 1) && (UART_RX_STATUS_ENABLE == 1)
+#error "The per-byte RX drain reads the data without the parity error flag of OUTR"
+#endif
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+/* Interrupts serving the TX and the RX FIFO */
+#define UART_TX_IRQn                    USIC0_0_IRQn
+#if (UART_COMBINED_IRQ_ENABLE == 1)
+#define UART_RX_IRQn                    USIC0_0_IRQn
+#else
+#define UART_RX_IRQn                    USIC0_1_IRQn
+#endif
+
+/* Runs of uart_fifo_irq_benchmark(), the fastest is kept */
+#define UART_IRQ_BENCHMARK_RUNS         8U
+
+/* Reads the oldest RX FIFO entry, data and receiver control information. A
+ * read of OUTR removes the entry; the host model in tools/model replaces it.
+ */
+#ifndef UART_RX_OUTR
+#define UART_RX_OUTR(channel)           ((channel)->OUTR)
+#endif
+
+/* Critical section against the FIFO interrupts */
+#define UART_FIFO_ENTER_CRITICAL()      uint32_t primask = __get_PRIMASK(); __disable_irq()
+#define UART_FIFO_EXIT_CRITICAL()       __set_PRIMASK(primask)
+
+/* Bytes moved per interrupt entry, the rest is served by a pended entry */
+#if (UART_ISR_MAX_BYTES != 0U)
+#define UART_ISR_BUDGET                 UART_ISR_MAX_BYTES
+#else
+#define UART_ISR_BUDGET                 UINT32_MAX
+#endif
+
+/* With the cipher, each byte costs one keystream load and XOR. The byte
+ * budget is limited by the keystream generated ahead; a transfer that used
+ * it up is resumed by uart_cipher_process().
+ */
+#if (UART_CIPHER_ENABLE == 1)
+#define UART_TX_BUDGET                  uart_cipher_budget(&uart_cipher_tx, UART_ISR_BUDGET)
+#define UART_RX_BUDGET                  uart_cipher_budget(&uart_cipher_rx, UART_ISR_BUDGET)
+#define UART_TX_STARVED()               uart_cipher_starved(&uart_cipher_tx)
+#define UART_RX_STARVED()               uart_cipher_starved(&uart_cipher_rx)
+#define UART_TX_CIPHER(data)            uart_cipher_apply(&uart_cipher_tx, (data))
+#define UART_RX_CIPHER(data)            uart_cipher_apply(&uart_cipher_rx, (data))
+#else
+#define UART_TX_BUDGET                  UART_ISR_BUDGET
+#define UART_RX_BUDGET                  UART_ISR_BUDGET
+#define UART_TX_STARVED()               (false)
+#define UART_RX_STARVED()               (false)
+#define UART_TX_CIPHER(data)            (data)
+#define UART_RX_CIPHER(data)            (data)
+#endif
+
+/* CRC of the plain data of the current write and read */
+#if (UART_CRC_ENABLE == 1)
+#define UART_TX_CRC(data)               (tx_crc = uart_crc_update(tx_crc, (data)))
+#define UART_RX_CRC(data)               (rx_crc = uart_crc_update(rx_crc, (data)))
+#else
+#define UART_TX_CRC(data)               ((void)0)
+#define UART_RX_CRC(data)               ((void)0)
+#endif
+
+/* A NULL transfer buffer is only valid as PRBS source and sink */
+#if (UART_PRBS_ENABLE == 1)
+#define UART_FIFO_BUFFER_VALID(data)    (true)
+#else
+#define UART_FIFO_BUFFER_VALID(data)    ((data) != NULL)
+#endif
+
+#if (UART_COALESCE_LATENCY_US != 0U)
+/* Clock of the CCU4 slice of the coalescing timer, and the largest
+ * prescaler setting, dividing by 2^15
+ */
+#if (UC_FAMILY == XMC1)
+#define UART_TIMER_CLOCK_HZ             XMC_SCU_CLOCK_GetFastPeripheralClockFrequency()
+#else
+#define UART_TIMER_CLOCK_HZ             XMC_SCU_CLOCK_GetCcuClockFrequency()
+#endif
+#define UART_TIMER_PRESCALER_MAX        15U
+#define UART_TIMER_PERIOD_MAX           0x10000U
+#endif
+
+/* RX FIFO limit without an active read. Once the stats command is registered,
+ * every byte raises the RX interrupt, so a command is served without a read.
+ */
+#if (UART_STATS_CMD_ENABLE == 1)
+#define UART_RX_IDLE_LIMIT              ((command_callback != NULL) ? 0U : rx_fifo_limit)
+#else
+#define UART_RX_IDLE_LIMIT              rx_fifo_limit
+#endif
+
+#if (UART_RX_TIMESTAMP_ENABLE == 1)
+#if ((UART_RX_TIMESTAMP_DEPTH & (UART_RX_TIMESTAMP_DEPTH - 1U)) != 0U)
+#error "UART_RX_TIMESTAMP_DEPTH must be a power of two"
+#endif
+#endif
+
+/*******************************************************************************
+*  Global Variables
+*******************************************************************************/
+/* Interrupt and byte counters */
+uart_stats_t uart_stats;
+
+#if (UART_STATS_CMD_ENABLE == 1)
+/* Data bytes received without an active read and invalid escape sequences */
+uint32_t uart_fifo_rx_discarded;
+uint32_t uart_fifo_rx_invalid;
+#endif
+
+/* Write transfer */
+static const uint8_t *tx_buffer;
+static uint32_t tx_length;
+static volatile uint32_t tx_index;
+static volatile bool tx_active;
+static volatile bool tx_refill_pending;
+#if (UART_CRC_ENABLE == 1)
+static uint16_t tx_crc;
+#endif
+#if (UART_STATS_CMD_ENABLE == 1)
+/* The escape of a data byte equal to the command byte has been sent */
+static bool tx_escaped;
+#endif
+
+/* Read transfer */
+static uint8_t *rx_buffer;
+static uint32_t rx_length;
+static volatile uint32_t rx_index;
+static volatile bool rx_active;
+static volatile bool rx_drain_pending;
+#if (UART_CRC_ENABLE == 1)
+static uint16_t rx_crc;
+#endif
+#if (UART_RX_STATUS_ENABLE == 1)
+static uint32_t *rx_error_map;
+#endif
+#if (UART_STATS_CMD_ENABLE == 1)
+/* A command byte was received, the next byte completes the sequence */
+static bool rx_escaped;
+#endif
+
+/* RX FIFO limit selected by the application and the limit in use */
+static uint32_t rx_fifo_limit = CYBSP_DEBUG_UART_RXFIFO_LIMIT;
+static uint32_t rx_limit_active = CYBSP_DEBUG_UART_RXFIFO_LIMIT;
+static uint32_t tx_fifo_limit = CYBSP_DEBUG_UART_TXFIFO_LIMIT;
+
+/* FIFO buffers of the channel in the USIC0 FIFO RAM */
+static uint32_t tx_fifo_words = UART_FIFO_SIZE;
+static uint32_t tx_fifo_pointer = UART_TX_FIFO_POINTER;
+static XMC_USIC_CH_FIFO_SIZE_t tx_fifo_size = XMC_USIC_CH_FIFO_SIZE_8WORDS;
+static uint32_t rx_fifo_words = UART_FIFO_SIZE;
+static uint32_t rx_fifo_pointer = UART_RX_FIFO_POINTER;
+static XMC_USIC_CH_FIFO_SIZE_t rx_fifo_size = XMC_USIC_CH_FIFO_SIZE_8WORDS;
+
+/* Baud rate the channel runs at */
+static uint32_t fifo_baudrate = UART_BAUDRATE;
+
+/* Completion callbacks */
+static uart_fifo_callback_t tx_callback;
+static uart_fifo_callback_t rx_callback;
+#if (UART_STATS_CMD_ENABLE == 1)
+static uart_fifo_callback_t command_callback;
+#endif
+
+#if (UART_COALESCE_LATENCY_US != 0U)
+/* RX FIFO level seen by the previous tick of the coalescing timer */
+static uint32_t timer_level;
+#endif
+
+#if (UART_RX_TIMESTAMP_ENABLE == 1)
+/* Timestamp ring of the last RX FIFO drains, the oldest entry is overwritten */
+static uart_rx_timestamp_t rx_timestamps[UART_RX_TIMESTAMP_DEPTH];
+static uint32_t rx_timestamp_head;
+#endif
+
+/*******************************************************************************
+* Function Name: uart_rx_set_limit
+********************************************************************************
+* Summary:
+* Programs the RX FIFO limit if it differs from the limit in use. The event
+* only occurs when the level rises through the limit, so if the level is
+* above a lowered limit already, the RX interrupt is pended.
+*
+* Parameters:
+*  limit: RX FIFO limit
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void uart_rx_set_limit(uint32_t limit)
+{
+    if (limit != rx_limit_active)
+    {
+        XMC_USIC_CH_RXFIFO_SetSizeTriggerLimit(CYBSP_DEBUG_UART_HW, rx_fifo_size, limit);
+        if ((limit < rx_limit_active) && (XMC_USIC_CH_RXFIFO_GetLevel(CYBSP_DEBUG_UART_HW) > limit))
+        {
+            rx_drain_pending = true;
+            NVIC_SetPendingIRQ(UART_RX_IRQn);
+        }
+        rx_limit_active = limit;
+        UART_TRACE(UART_TRACE_RX_LIMIT, limit);
+    }
+}
+
+/*******************************************************************************
+* Function Name: uart_tx_next
+********************************************************************************
+* Summary:
+* Returns the byte of the write at tx_index, from the write buffer or, without
+* write buffer, from the PRBS generator.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint8_t: Next byte to transmit
+*
+*******************************************************************************/
+static inline uint8_t uart_tx_next(void)
+{
+#if (UART_PRBS_ENABLE == 1)
+    return (tx_buffer != NULL) ? tx_buffer[tx_index] : uart_prbs_next(&uart_prbs_generator);
+#else
+    return tx_buffer[tx_index];
+#endif
+}
+
+/*******************************************************************************
+* Function Name: uart_tx_refill
+********************************************************************************
+* Summary:
+* Transmit handling. The function is called everytime the number of elements
+* in the TX FIFO reduces below TX FIFO Limit. The function is used to fill
+* the TX FIFO with the next elements of the write buffer until it is full.
+* When the whole buffer has been written, the TX FIFO event is disabled and
+* the completion callback is called.
+* At most UART_ISR_BUDGET bytes are written per call; if the TX FIFO still has
+* room, the TX interrupt is pended to continue. If the last bytes leave the
+* level below the limit, no event follows, so the TX interrupt is pended to
+* complete. With the cipher, a refill that ran out of keystream is resumed by
+* uart_cipher_process().
+* With the stats command, a data byte equal to UART_STATS_CMD_BYTE is sent
+* twice, so the receiver does not take it for a command.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void uart_tx_refill(void)
+{
+    tx_refill_pending = false;
+
+    if (!tx_active)
+    {
+        return;
+    }
+
+    /* If still remaining data to be send */
+    if (tx_index < tx_length)
+    {
+        uint32_t first = tx_index;
+        uint32_t budget;
+
+        /* Fill the TX FIFO with the next elements of the write buffer */
+        for (budget = UART_TX_BUDGET;
+             (budget != 0U) && (tx_index < tx_length) && !XMC_USIC_CH_TXFIFO_IsFull(CYBSP_DEBUG_UART_HW);
+             budget--)
+        {
+            uint8_t data;
+
+#if (UART_STATS_CMD_ENABLE == 1)
+            /* The escape takes one FIFO entry, the byte itself follows in the
+             * next one without fetching it again
+             */
+            if (tx_escaped)
+            {
+                tx_escaped = false;
+                data = UART_STATS_CMD_BYTE;
+            }
+            else
+            {
+                data = uart_tx_next();
+                if (data == UART_STATS_CMD_BYTE)
+                {
+                    tx_escaped = true;
+                    XMC_UART_CH_Transmit(CYBSP_DEBUG_UART_HW, UART_TX_CIPHER(data));
+                    uart_stats.tx_bytes++;
+                    continue;
+                }
+            }
+#else
+            data = uart_tx_next();
+#endif
+
+            UART_TX_CRC(data);
+            XMC_UART_CH_Transmit(CYBSP_DEBUG_UART_HW, UART_TX_CIPHER(data));
+            tx_index++;
+            uart_stats.tx_bytes++;
+        }
+        UART_TRACE(UART_TRACE_TX_REFILL, tx_index - first);
+
+        if ((budget == 0U) && !XMC_USIC_CH_TXFIFO_IsFull(CYBSP_DEBUG_UART_HW) && !UART_TX_STARVED())
+        {
+            tx_refill_pending = true;
+            NVIC_SetPendingIRQ(UART_TX_IRQn);
+        }
+        else if ((tx_index >= tx_length) &&
+                 (XMC_USIC_CH_TXFIFO_GetLevel(CYBSP_DEBUG_UART_HW) < tx_fifo_limit))
+        {
+            tx_refill_pending = true;
+            NVIC_SetPendingIRQ(UART_TX_IRQn);
+        }
+    }
+    else
+    {
+        /* Disable the TX FIFO Event when all the data in the write
+         * buffer has been transmitted
+         */
+        XMC_USIC_CH_TXFIFO_DisableEvent(CYBSP_DEBUG_UART_HW,
+                                        XMC_USIC_CH_TXFIFO_EVENT_CONF_STANDARD);
+        tx_active = false;
+        UART_TRACE(UART_TRACE_TX_DONE, tx_length);
+
+        if (tx_callback != NULL)
+        {
+            tx_callback();
+        }
+    }
+}
+
+#if (UART_STATS_CMD_ENABLE == 1)
+/*******************************************************************************
+* Function Name: uart_rx_unescape
+********************************************************************************
+* Summary:
+* Decodes the command escape on the RX path. UART_STATS_CMD_BYTE starts a
+* two-byte sequence: followed by itself it is one data byte, followed by
+* UART_STATS_CMD_REQUEST it calls the command handler. Any other second byte
+* is counted in uart_fifo_rx_invalid and dropped with the escape.
+*
+* Parameters:
+*  data: Received byte, decrypted
+*
+* Return:
+*  bool: true if data is a data byte
+*
+*******************************************************************************/
+static inline bool uart_rx_unescape(uint8_t data)
+{
+    if (!rx_escaped)
+    {
+        rx_escaped = (data == UART_STATS_CMD_BYTE);
+        return !rx_escaped;
+    }
+
+    rx_escaped = false;
+    if (data == UART_STATS_CMD_BYTE)
+    {
+        return true;
+    }
+
+    if ((data == UART_STATS_CMD_REQUEST) && (command_callback != NULL))
+    {
+        command_callback();
+    }
+    else
+    {
+        uart_fifo_rx_invalid++;
+    }
+    return false;
+}
+
+/*******************************************************************************
+* Function Name: uart_rx_discard
+********************************************************************************
+* Summary:
+* Receive handling without an active read once the stats command is
+* registered. Serves the commands in the RX FIFO and discards the data bytes,
+* counted in uart_fifo_rx_discarded. At most UART_ISR_BUDGET bytes are read
+* per call like in uart_rx_drain().
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void uart_rx_discard(void)
+{
+    XMC_USIC_CH_t *const channel = CYBSP_DEBUG_UART_HW;
+    uint32_t count = XMC_USIC_CH_RXFIFO_GetLevel(channel);
+    uint32_t budget = UART_RX_BUDGET;
+
+    if (count > budget)
+    {
+        count = budget;
+    }
+    budget -= count;
+    uart_stats.rx_bytes += count;
+
+    while (count != 0U)
+    {
+        if (uart_rx_unescape(UART_RX_CIPHER((uint8_t)UART_RX_OUTR(channel))))
+        {
+            uart_fifo_rx_discarded++;
+        }
+        count--;
+    }
+
+    if ((budget == 0U) && !XMC_USIC_CH_RXFIFO_IsEmpty(channel) && !UART_RX_STARVED())
+    {
+        rx_drain_pending = true;
+        NVIC_SetPendingIRQ(UART_RX_IRQn);
+    }
+}
+#endif
+
+/*******************************************************************************
+* Function Name: uart_rx_store
+********************************************************************************
+* Summary:
+* Stores one received byte: decrypts it, consumes a command escape or feeds
+* the PRBS checker, otherwise adds it to the CRC and the read buffer. With
+* an error map, the parity error flag of the entry is recorded as well.
+*
+* Parameters:
+*  outr: RX FIFO entry, data and receiver control information
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static inline void uart_rx_store(uint32_t outr)
+{
+    uint8_t data = UART_RX_CIPHER((uint8_t)outr);
+
+#if (UART_STATS_CMD_ENABLE == 1)
+    /* Escapes and commands are consumed and not stored */
+    if (!uart_rx_unescape(data))
+    {
+        return;
+    }
+#endif
+#if (UART_PRBS_ENABLE == 1)
+    /* Without read buffer the PRBS checker is the sink */
+    if (rx_buffer == NULL)
+    {
+        uart_prbs_check(&uart_prbs_checker, data);
+        rx_index++;
+        return;
+    }
+#endif
+    UART_RX_CRC(data);
+#if (UART_RX_STATUS_ENABLE == 1)
+    if (rx_error_map != NULL)
+    {
+        rx_error_map[rx_index / 32U] |= UART_RX_STATUS_PERR(outr) << (rx_index % 32U);
+    }
+#endif
+    rx_buffer[rx_index++] = data;
+}
+
+/*******************************************************************************
+* Function Name: uart_rx_read
+********************************************************************************
+* Summary:
+* Reads a known number of entries from the RX FIFO, unrolled by four. Each
+* byte is a single read of OUTR, which also carries the status of the entry;
+* XMC_UART_CH_GetReceivedData() would also read RBCTR to choose between
+* RBUF and OUTR.
+*
+* Parameters:
+*  count: Number of entries, at most the RX FIFO level
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static inline void uart_rx_read(uint32_t count)
+{
+    XMC_USIC_CH_t *const channel = CYBSP_DEBUG_UART_HW;
+
+    while (count >= 4U)
+    {
+        uart_rx_store(UART_RX_OUTR(channel));
+        uart_rx_store(UART_RX_OUTR(channel));
+        uart_rx_store(UART_RX_OUTR(channel));
+        uart_rx_store(UART_RX_OUTR(channel));
+        count -= 4U;
+    }
+    while (count != 0U)
+    {
+        uart_rx_store(UART_RX_OUTR(channel));
+        count--;
+    }
+}
+
+/*******************************************************************************
+* Function Name: uart_rx_drain
+********************************************************************************
+* Summary:
+* Receive handling. The function is called everytime the number of elements
+* in the RX FIFO exceeds above Rx FIFO Limit. The function is used to read the
+* RX FIFO into the read buffer, but never beyond its length. Without an active
+* read the data is left in the RX FIFO, unless the stats command is registered;
+* then commands are served and data is discarded, see uart_rx_discard().
+* If the remaining data to be received is smaller than the RX FIFO limit,
+* the limit is lowered to the remaining data minus 1 in order to trigger the
+* interrupt when all the data has been received.
+* The RX FIFO level is read once per batch instead of checking the FIFO
+* before every byte, unless UART_RX_DRAIN_PER_BYTE selects the per-byte loop
+* for comparison.
+* At most UART_ISR_BUDGET bytes are read per call; if the RX FIFO is not empty
+* then, the RX interrupt is pended to continue. With the cipher, a drain that
+* ran out of keystream is resumed by uart_cipher_process().
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void uart_rx_drain(void)
+{
+    uint32_t remaining;
+    uint32_t first;
+    uint32_t level;
+    uint32_t budget;
+#if (UART_RX_DRAIN_PER_BYTE == 0)
+    uint32_t count;
+#endif
+#if (UART_RX_TIMESTAMP_ENABLE == 1)
+    uint32_t timestamp;
+    uint32_t first_byte;
+#endif
+
+    rx_drain_pending = false;
+
+    if (!rx_active)
+    {
+#if (UART_STATS_CMD_ENABLE == 1)
+        if (command_callback != NULL)
+        {
+            uart_rx_discard();
+        }
+#endif
+        return;
+    }
+
+#if (UART_RX_TIMESTAMP_ENABLE == 1)
+    /* Sample the time and the FIFO level together before reading */
+    timestamp = uart_timestamp_now();
+    first_byte = uart_stats.rx_bytes;
+#endif
+    level = XMC_USIC_CH_RXFIFO_GetLevel(CYBSP_DEBUG_UART_HW);
+
+    if (level > uart_stats.rx_fifo_level_max)
+    {
+        uart_stats.rx_fifo_level_max = level;
+    }
+    if (level >= rx_fifo_words)
+    {
+        uart_stats.rx_fifo_full++;
+    }
+
+    first = rx_index;
+    budget = UART_RX_BUDGET;
+#if (UART_RX_DRAIN_PER_BYTE == 1)
+    /* Read the RX FIFO till it is empty or the read buffer is full, checking
+     * the FIFO state before every byte
+     */
+    while ((budget != 0U) && (rx_index < rx_length) && !XMC_USIC_CH_RXFIFO_IsEmpty(CYBSP_DEBUG_UART_HW))
+    {
+        budget--;
+        uart_stats.rx_bytes++;
+        uart_rx_store(XMC_UART_CH_GetReceivedData(CYBSP_DEBUG_UART_HW));
+    }
+#else
+    /* Read the RX FIFO till it is empty or the read buffer is full. The
+     * level is read once per batch and then exactly that many entries are
+     * read, without checking the FIFO state per byte.
+     */
+    count = level;
+    while (count != 0U)
+    {
+        if (count > budget)
+        {
+            count = budget;
+        }
+        if (count > (rx_length - rx_index))
+        {
+            count = rx_length - rx_index;
+        }
+        budget -= count;
+        uart_stats.rx_bytes += count;
+        uart_rx_read(count);
+
+        /* Pick up the data that arrived meanwhile */
+        count = ((budget != 0U) && (rx_index < rx_length)) ? XMC_USIC_CH_RXFIFO_GetLevel(CYBSP_DEBUG_UART_HW) : 0U;
+    }
+#endif
+    UART_TRACE(UART_TRACE_RX_DRAIN, rx_index - first);
+
+#if (UART_RX_TIMESTAMP_ENABLE == 1)
+    if (uart_stats.rx_bytes != first_byte)
+    {
+        uart_rx_timestamp_t *entry = &rx_timestamps[rx_timestamp_head & (UART_RX_TIMESTAMP_DEPTH - 1U)];
+
+        entry->timestamp = timestamp;
+        entry->first_byte = first_byte;
+        entry->level = (uint8_t)level;
+        entry->count = (uint8_t)(uart_stats.rx_bytes - first_byte);
+        rx_timestamp_head++;
+    }
+#endif
+
+    remaining = rx_length - rx_index;
+
+    if ((budget == 0U) && (remaining != 0U) && !XMC_USIC_CH_RXFIFO_IsEmpty(CYBSP_DEBUG_UART_HW) &&
+        !UART_RX_STARVED())
+    {
+        rx_drain_pending = true;
+        NVIC_SetPendingIRQ(UART_RX_IRQn);
+    }
+
+    /* If all the data have been received */
+    if (remaining == 0U)
+    {
+        rx_active = false;
+        UART_TRACE(UART_TRACE_RX_DONE, rx_length);
+        uart_rx_set_limit(UART_RX_IDLE_LIMIT);
+
+        if (rx_callback != NULL)
+        {
+            rx_callback();
+        }
+    }
+    else if (remaining <= rx_fifo_limit)
+    {
+        uart_rx_set_limit(remaining - 1U);
+    }
+    else
+    {
+        uart_rx_set_limit(rx_fifo_limit);
+    }
+}
+
+#if (UART_COMBINED_IRQ_ENABLE == 1)
+/*******************************************************************************
+* Function Name: USIC0_0_IRQHandler
+********************************************************************************
+* Summary:
+* Combined TX and RX IRQ Handler. Both FIFO events are routed to service
+* request 0, so back-to-back events cost one exception entry. The RX FIFO is
+* drained first since an overflow loses data while a late refill only leaves
+* a gap on the line. An entry without TX event always drains the RX FIFO,
+* which also covers a pended interrupt (new read, coalescing timer); a drain
+* pended next to a TX event is flagged. A refill cut short by the byte budget
+* is continued on the next entry.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void USIC0_0_IRQHandler(void)
+{
+    uint32_t start = uart_cycles_now();
+    uint32_t rx_event = XMC_USIC_CH_RXFIFO_GetEvent(CYBSP_DEBUG_UART_HW) &
+                        (XMC_USIC_CH_RXFIFO_EVENT_STANDARD | XMC_USIC_CH_RXFIFO_EVENT_ALTERNATE);
+    uint32_t tx_event = XMC_USIC_CH_TXFIFO_GetEvent(CYBSP_DEBUG_UART_HW) &
+                        XMC_USIC_CH_TXFIFO_EVENT_STANDARD;
+
+    UART_TRACE(UART_TRACE_ISR_BEGIN, 0U);
+
+    if ((rx_event != 0U) || rx_drain_pending || (tx_event == 0U))
+    {
+        XMC_USIC_CH_RXFIFO_ClearEvent(CYBSP_DEBUG_UART_HW, rx_event);
+        uart_stats.rx_irq_count++;
+        uart_rx_drain();
+    }
+
+    if ((tx_event != 0U) || tx_refill_pending)
+    {
+        XMC_USIC_CH_TXFIFO_ClearEvent(CYBSP_DEBUG_UART_HW, tx_event);
+        uart_stats.tx_irq_count++;
+        uart_tx_refill();
+
+        if (rx_event != 0U)
+        {
+            uart_stats.combined_count++;
+        }
+    }
+
+    UART_TRACE(UART_TRACE_ISR_END, 0U);
+    uart_stats_add_isr_cycles(&uart_stats, uart_cycles_elapsed(start));
+}
+#else
+/*******************************************************************************
+* Function Name: USIC0_0_IRQHandler
+********************************************************************************
+* Summary:
+* Transmit IRQ Handler, called on the TX FIFO limit event.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void USIC0_0_IRQHandler(void)
+{
+    uint32_t start = uart_cycles_now();
+
+    UART_TRACE(UART_TRACE_ISR_BEGIN, 0U);
+    uart_stats.tx_irq_count++;
+    uart_tx_refill();
+    UART_TRACE(UART_TRACE_ISR_END, 0U);
+
+    uart_stats_add_isr_cycles(&uart_stats, uart_cycles_elapsed(start));
+}
+
+/*******************************************************************************
+* Function Name: USIC0_1_IRQHandler
+********************************************************************************
+* Summary:
+* Receive IRQ Handler, called on the RX FIFO limit event.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void USIC0_1_IRQHandler(void)
+{
+    uint32_t start = uart_cycles_now();
+
+    UART_TRACE(UART_TRACE_ISR_BEGIN, 1U);
+    uart_stats.rx_irq_count++;
+    uart_rx_drain();
+    UART_TRACE(UART_TRACE_ISR_END, 1U);
+
+    uart_stats_add_isr_cycles(&uart_stats, uart_cycles_elapsed(start));
+}
+#endif
+
+#if (UART_COALESCE_LATENCY_US != 0U)
+/*******************************************************************************
+* Function Name: UART_COALESCE_TIMER_HANDLER
+********************************************************************************
+* Summary:
+* Coalescing timer fallback. Bytes below the RX FIFO limit at the end of a
+* stream do not raise the RX FIFO event. If a read is active and the RX FIFO
+* level is the same non-zero level as on the previous tick, the stream has
+* stopped and the RX interrupt is pended to drain the tail. A stream that
+* keeps adding bytes reaches the limit by itself.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void UART_COALESCE_TIMER_HANDLER(void)
+{
+    uint32_t level;
+
+    XMC_CCU4_SLICE_ClearEvent(UART_COALESCE_CCU4_SLICE, XMC_CCU4_SLICE_IRQ_ID_PERIOD_MATCH);
+
+    level = XMC_USIC_CH_RXFIFO_GetLevel(CYBSP_DEBUG_UART_HW);
+    if (rx_active && (level != 0U) && (level == timer_level))
+    {
+        uart_stats.timer_irq_count++;
+        rx_drain_pending = true;
+        NVIC_SetPendingIRQ(UART_RX_IRQn);
+    }
+    timer_level = level;
+}
+
+/*******************************************************************************
+* Function Name: uart_fifo_start_timer
+********************************************************************************
+* Summary:
+* Starts the coalescing fallback timer on the CCU4 slice set in uart_config.h,
+* so SysTick stays free for the RTOS tick and the XMC1 cycle counter. The
+* prescaler is the smallest that fits the period into the 16-bit timer. A
+* tail waits at most two periods, so pass half the latency budget. A running
+* timer is restarted with the new period.
+*
+* Parameters:
+*  period_us: Timer period in microseconds
+*
+* Return:
+*  bool: false if the period can not be set at the CCU4 clock; the timer is
+*        not started then
+*
+*******************************************************************************/
+bool uart_fifo_start_timer(uint32_t period_us)
+{
+    uint64_t ticks = ((uint64_t)UART_TIMER_CLOCK_HZ * period_us) / 1000000U;
+    uint32_t prescaler = 0U;
+    XMC_CCU4_SLICE_COMPARE_CONFIG_t timer_config =
+    {
+        .timer_mode = XMC_CCU4_SLICE_TIMER_COUNT_MODE_EA,
+        .monoshot = false,
+        .prescaler_mode = XMC_CCU4_SLICE_PRESCALER_MODE_NORMAL,
+        .passive_level = XMC_CCU4_SLICE_OUTPUT_PASSIVE_LEVEL_LOW,
+        .timer_concatenation = false
+    };
+
+    while (((ticks >> prescaler) > UART_TIMER_PERIOD_MAX) && (prescaler < UART_TIMER_PRESCALER_MAX))
+    {
+        prescaler++;
+    }
+    ticks >>= prescaler;
+    if ((ticks == 0U) || (ticks > UART_TIMER_PERIOD_MAX))
+    {
+        return false;
+    }
+    timer_config.prescaler_initval = prescaler;
+
+    /* The module may already run the XMC1 timestamp slice, so it is only
+     * enabled here, not initialized
+     */
+    XMC_CCU4_EnableModule(UART_COALESCE_CCU4_MODULE);
+    XMC_CCU4_StartPrescaler(UART_COALESCE_CCU4_MODULE);
+    XMC_CCU4_SLICE_StopTimer(UART_COALESCE_CCU4_SLICE);
+    XMC_CCU4_SLICE_ClearTimer(UART_COALESCE_CCU4_SLICE);
+    XMC_CCU4_SLICE_CompareInit(UART_COALESCE_CCU4_SLICE, &timer_config);
+    XMC_CCU4_SLICE_SetTimerPeriodMatch(UART_COALESCE_CCU4_SLICE, (uint16_t)(ticks - 1U));
+    XMC_CCU4_EnableShadowTransfer(UART_COALESCE_CCU4_MODULE, UART_COALESCE_CCU4_SHADOW);
+    XMC_CCU4_SLICE_SetInterruptNode(UART_COALESCE_CCU4_SLICE, XMC_CCU4_SLICE_IRQ_ID_PERIOD_MATCH,
+                                    UART_COALESCE_CCU4_SR);
+    XMC_CCU4_SLICE_EnableEvent(UART_COALESCE_CCU4_SLICE, XMC_CCU4_SLICE_IRQ_ID_PERIOD_MATCH);
+    NVIC_SetPriority(UART_COALESCE_TIMER_IRQn, UART_COALESCE_TIMER_PRIORITY);
+    NVIC_EnableIRQ(UART_COALESCE_TIMER_IRQn);
+    XMC_CCU4_EnableClock(UART_COALESCE_CCU4_MODULE, UART_COALESCE_CCU4_SLICE_NUM);
+    XMC_CCU4_SLICE_StartTimer(UART_COALESCE_CCU4_SLICE);
+
+    return true;
+}
+#endif
+
+/*******************************************************************************
+* Function Name: uart_fifo_claim_ram
+********************************************************************************
+* Summary:
+* Marks the FIFO buffers configured in design.modus as used in the USIC0 FIFO
+* RAM, once.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void uart_fifo_claim_ram(void)
+{
+    static bool claimed = false;
+
+    if (!claimed)
+    {
+        (void)uart_fifo_ram_reserve(&uart_fifo_ram_usic0, UART_TX_FIFO_POINTER, UART_FIFO_SIZE);
+        (void)uart_fifo_ram_reserve(&uart_fifo_ram_usic0, UART_RX_FIFO_POINTER, UART_FIFO_SIZE);
+        claimed = true;
+    }
+}
+
+/*******************************************************************************
+* Function Name: uart_fifo_init
+********************************************************************************
+* Summary:
+* Configures the FIFO interrupts of the channel initialized by cybsp_init().
+* The TX FIFO event stays disabled until a write is started.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void uart_fifo_init(void)
+{
+    /* Start the cycle counter for the handler measurements */
+    uart_cycles_init();
+#if (UART_TRACE_ENABLE == 1)
+    uart_trace_init();
+#endif
+#if (UART_RX_TIMESTAMP_ENABLE == 1)
+    uart_timestamp_init();
+#endif
+
+    XMC_USIC_CH_TXFIFO_DisableEvent(CYBSP_DEBUG_UART_HW, XMC_USIC_CH_TXFIFO_EVENT_CONF_STANDARD);
+    uart_fifo_claim_ram();
+
+#if (UART_COMBINED_IRQ_ENABLE == 1)
+    /* Route the RX FIFO events to service request 0 next to the TX FIFO
+     * event. The combined handler runs at the RX priority.
+     */
+    XMC_USIC_CH_RXFIFO_SetInterruptNodePointer(CYBSP_DEBUG_UART_HW,
+                                               XMC_USIC_CH_RXFIFO_INTERRUPT_NODE_POINTER_STANDARD, 0U);
+    XMC_USIC_CH_RXFIFO_SetInterruptNodePointer(CYBSP_DEBUG_UART_HW,
+                                               XMC_USIC_CH_RXFIFO_INTERRUPT_NODE_POINTER_ALTERNATE, 0U);
+    NVIC_SetPriority(USIC0_0_IRQn, USIC0_1_IRQn_PRIORITY);
+    NVIC_EnableIRQ(USIC0_0_IRQn);
+#else
+    /* Configuring priority and enabling NVIC IRQ
+     * for the defined Service Request line number
+     */
+    NVIC_SetPriority(USIC0_0_IRQn, USIC0_0_IRQn_PRIORITY);
+    NVIC_EnableIRQ(USIC0_0_IRQn);
+    NVIC_SetPriority(USIC0_1_IRQn, USIC0_1_IRQn_PRIORITY);
+    NVIC_EnableIRQ(USIC0_1_IRQn);
+#endif
+}
+
+/*******************************************************************************
+* Function Name: uart_fifo_register_callbacks
+********************************************************************************
+* Summary:
+* Registers the completion callbacks. They are called from interrupt context.
+*
+* Parameters:
+*  tx_done: Called when the write buffer has been moved to the TX FIFO
+*  rx_done: Called when the read buffer is full
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void uart_fifo_register_callbacks(uart_fifo_callback_t tx_done, uart_fifo_callback_t rx_done)
+{
+    tx_callback = tx_done;
+    rx_callback = rx_done;
+}
+
+#if (UART_STATS_CMD_ENABLE == 1)
+/*******************************************************************************
+* Function Name: uart_fifo_register_command
+********************************************************************************
+* Summary:
+* Registers the handler of the stats command, the sequence UART_STATS_CMD_BYTE,
+* UART_STATS_CMD_REQUEST. The sequence is removed from the received data and
+* the handler is called from the RX interrupt, also without an active read;
+* data received without a read is then discarded. A data byte equal to
+* UART_STATS_CMD_BYTE is doubled on TX and on RX, see uart_rx_unescape().
+*
+* Parameters:
+*  command: Called on every command byte received
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void uart_fifo_register_command(uart_fifo_callback_t command)
+{
+    UART_FIFO_ENTER_CRITICAL();
+
+    command_callback = command;
+    if (!rx_active)
+    {
+        uart_rx_set_limit(UART_RX_IDLE_LIMIT);
+    }
+
+    UART_FIFO_EXIT_CRITICAL();
+}
+#endif
+
+/*******************************************************************************
+* Function Name: uart_fifo_set_limits
+********************************************************************************
+* Summary:
+* Sets the TX and RX FIFO limits, for example selected by interrupt
+* coalescing. The TX FIFO level can not fall below 0, so a TX limit of 0 is
+* raised to 1.
+*
+* Parameters:
+*  tx_limit: TX FIFO limit, event when the level falls below
+*  rx_limit: RX FIFO limit, event when the level exceeds
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void uart_fifo_set_limits(uint32_t tx_limit, uint32_t rx_limit)
+{
+    UART_FIFO_ENTER_CRITICAL();
+
+    tx_fifo_limit = (tx_limit == 0U) ? 1U : ((tx_limit < tx_fifo_words) ? tx_limit : (tx_fifo_words - 1U));
+    XMC_USIC_CH_TXFIFO_SetSizeTriggerLimit(CYBSP_DEBUG_UART_HW, tx_fifo_size, tx_fifo_limit);
+    rx_fifo_limit = (rx_limit < rx_fifo_words) ? rx_limit : (rx_fifo_words - 1U);
+    uart_rx_set_limit(rx_active ? rx_fifo_limit : UART_RX_IDLE_LIMIT);
+
+    UART_FIFO_EXIT_CRITICAL();
+}
+
+/*******************************************************************************
+* Function Name: uart_fifo_get_limits
+********************************************************************************
+* Summary:
+* Returns the TX and RX FIFO limits set with uart_fifo_set_limits().
+*
+* Parameters:
+*  tx_limit: TX FIFO limit
+*  rx_limit: RX FIFO limit
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void uart_fifo_get_limits(uint32_t *tx_limit, uint32_t *rx_limit)
+{
+    *tx_limit = tx_fifo_limit;
+    *rx_limit = rx_fifo_limit;
+}
+
+/*******************************************************************************
+* Function Name: uart_fifo_set_baudrate
+********************************************************************************
+* Summary:
+* Records the baud rate the channel runs at, UART_BAUDRATE until then. Call
+* after every change of the baud rate; uart_reconfig() does.
+*
+* Parameters:
+*  baudrate: Achieved baud rate
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void uart_fifo_set_baudrate(uint32_t baudrate)
+{
+    fifo_baudrate = baudrate;
+}
+
+/*******************************************************************************
+* Function Name: uart_fifo_baudrate
+********************************************************************************
+* Summary:
+* Returns the baud rate the channel runs at.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t
+*
+*******************************************************************************/
+uint32_t uart_fifo_baudrate(void)
+{
+    return fifo_baudrate;
+}
+
+/*******************************************************************************
+* Function Name: uart_fifo_frame_bits
+********************************************************************************
+* Summary:
+* Returns the bits per frame as programmed in the channel: the start bit, the
+* frame length, the parity bit if enabled and the stop bits.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t
+*
+*******************************************************************************/
+uint32_t uart_fifo_frame_bits(void)
+{
+    uint32_t bits = 1U + ((CYBSP_DEBUG_UART_HW->SCTR & USIC_CH_SCTR_FLE_Msk) >> USIC_CH_SCTR_FLE_Pos) + 1U;
+
+    if ((CYBSP_DEBUG_UART_HW->CCR & USIC_CH_CCR_PM_Msk) != 0U)
+    {
+        bits++;
+    }
+    bits += ((CYBSP_DEBUG_UART_HW->PCR_ASCMode & USIC_CH_PCR_ASCMode_STPB_Msk) != 0U) ? 2U : 1U;
+
+    return bits;
+}
+
+/*******************************************************************************
+* Function Name: uart_fifo_size_code
+********************************************************************************
+* Summary:
+* Returns the FIFO size setting of a buffer size.
+*
+* Parameters:
+*  words: Buffer size in words, a power of two from 2 to 64
+*
+* Return:
+*  XMC_USIC_CH_FIFO_SIZE_t
+*
+*******************************************************************************/
+static XMC_USIC_CH_FIFO_SIZE_t uart_fifo_size_code(uint32_t words)
+{
+    uint32_t code = 0U;
+
+    while ((1UL << code) < words)
+    {
+        code++;
+    }
+    return (XMC_USIC_CH_FIFO_SIZE_t)code;
+}
+
+/*******************************************************************************
+* Function Name: uart_fifo_set_sizes
+********************************************************************************
+* Summary:
+* Resizes the TX and RX FIFO. The buffers are reallocated from the USIC0 FIFO
+* RAM, the larger one first so the aligned free space stays together. The RX
+* FIFO limit scales with the RX FIFO size, so a 4 times larger RX FIFO takes 4
+* times fewer RX interrupts; the TX FIFO limit is kept. Call it without active
+* transfers; data in the RX FIFO is discarded.
+*
+* Parameters:
+*  tx_words: TX FIFO size in words, a power of two from 2 to 64
+*  rx_words: RX FIFO size in words, a power of two from 2 to 64
+*
+* Return:
+*  bool: false if a transfer is active or the FIFO RAM has no room, the
+*        previous sizes stay in use
+*
+*******************************************************************************/
+bool uart_fifo_set_sizes(uint32_t tx_words, uint32_t rx_words)
+{
+    uart_fifo_ram_t *ram = &uart_fifo_ram_usic0;
+    bool rx_first = (rx_words >= tx_words);
+    uint32_t tx_pointer = 0U;
+    uint32_t rx_pointer = 0U;
+    bool resized = false;
+
+    UART_FIFO_ENTER_CRITICAL();
+
+    uart_fifo_claim_ram();
+    if (!tx_active && !rx_active && XMC_USIC_CH_TXFIFO_IsEmpty(CYBSP_DEBUG_UART_HW))
+    {
+        uart_fifo_ram_free(ram, tx_fifo_pointer, tx_fifo_words);
+        uart_fifo_ram_free(ram, rx_fifo_pointer, rx_fifo_words);
+
+        if (rx_first ? uart_fifo_ram_alloc(ram, rx_words, &rx_pointer) : uart_fifo_ram_alloc(ram, tx_words, &tx_pointer))
+        {
+            if (rx_first ? uart_fifo_ram_alloc(ram, tx_words, &tx_pointer) : uart_fifo_ram_alloc(ram, rx_words, &rx_pointer))
+            {
+                resized = true;
+            }
+            else
+            {
+                uart_fifo_ram_free(ram, rx_first ? rx_pointer : tx_pointer, rx_first ? rx_words : tx_words);
+            }
+        }
+
+        if (resized)
+        {
+            rx_fifo_limit = (rx_fifo_limit * rx_words) / rx_fifo_words;
+            if (rx_fifo_limit >= rx_words)
+            {
+                rx_fifo_limit = rx_words - 1U;
+            }
+            if (tx_fifo_limit >= tx_words)
+            {
+                tx_fifo_limit = tx_words - 1U;
+            }
+
+            tx_fifo_words = tx_words;
+            tx_fifo_pointer = tx_pointer;
+            tx_fifo_size = uart_fifo_size_code(tx_words);
+            rx_fifo_words = rx_words;
+            rx_fifo_pointer = rx_pointer;
+            rx_fifo_size = uart_fifo_size_code(rx_words);
+            rx_limit_active = rx_fifo_limit;
+
+            XMC_USIC_CH_TXFIFO_Configure(CYBSP_DEBUG_UART_HW, tx_fifo_pointer, tx_fifo_size, tx_fifo_limit);
+            XMC_USIC_CH_RXFIFO_Configure(CYBSP_DEBUG_UART_HW, rx_fifo_pointer, rx_fifo_size, rx_fifo_limit);
+        }
+        else
+        {
+            (void)uart_fifo_ram_reserve(ram, tx_fifo_pointer, tx_fifo_words);
+            (void)uart_fifo_ram_reserve(ram, rx_fifo_pointer, rx_fifo_words);
+        }
+    }
+
+    UART_FIFO_EXIT_CRITICAL();
+
+    return resized;
+}
+
+/*******************************************************************************
+* Function Name: uart_fifo_write
+********************************************************************************
+* Summary:
+* Starts writing a buffer. The TX FIFO is filled right away, the TX FIFO
+* interrupt refills it until the whole buffer has been written. The buffer
+* must stay valid until the transfer completes.
+*
+* Parameters:
+*  data:   Data to transmit, NULL for the PRBS generator (UART_PRBS_ENABLE)
+*  length: Number of bytes
+*
+* Return:
+*  bool: false if a write is already active, length is zero or data is NULL
+*
+*******************************************************************************/
+bool uart_fifo_write(const uint8_t *data, uint32_t length)
+{
+    bool started = false;
+
+    UART_FIFO_ENTER_CRITICAL();
+
+    if (!tx_active && (length != 0U) && UART_FIFO_BUFFER_VALID(data))
+    {
+        tx_buffer = data;
+        tx_length = length;
+        tx_index = 0U;
+#if (UART_CRC_ENABLE == 1)
+        tx_crc = UART_CRC_INIT;
+#endif
+#if (UART_STATS_CMD_ENABLE == 1)
+        tx_escaped = false;
+#endif
+        tx_active = true;
+
+        XMC_USIC_CH_TXFIFO_EnableEvent(CYBSP_DEBUG_UART_HW, XMC_USIC_CH_TXFIFO_EVENT_CONF_STANDARD);
+        uart_tx_refill();
+        started = true;
+    }
+
+    UART_FIFO_EXIT_CRITICAL();
+
+    return started;
+}
+
+/*******************************************************************************
+* Function Name: uart_rx_start
+********************************************************************************
+* Summary:
+* Starts reading into a buffer and, if given, an error map. The RX interrupt
+* is pended once to pick up data already waiting in the RX FIFO.
+*
+* Parameters:
+*  data:      Buffer for the received data, NULL for the PRBS checker (UART_PRBS_ENABLE)
+*  error_map: Parity error map, UART_RX_STATUS_WORDS(length) words (can be NULL)
+*  length:    Number of bytes
+*
+* Return:
+*  bool: false if a read is already active, length is zero or data is NULL
+*
+*******************************************************************************/
+static bool uart_rx_start(uint8_t *data, uint32_t *error_map, uint32_t length)
+{
+    bool started = false;
+
+    UART_FIFO_ENTER_CRITICAL();
+
+    if (!rx_active && (length != 0U) && UART_FIFO_BUFFER_VALID(data))
+    {
+        rx_buffer = data;
+        rx_length = length;
+        rx_index = 0U;
+#if (UART_CRC_ENABLE == 1)
+        rx_crc = UART_CRC_INIT;
+#endif
+#if (UART_RX_STATUS_ENABLE == 1)
+        /* The interrupt only sets bits, so the map starts cleared */
+        rx_error_map = error_map;
+        if (error_map != NULL)
+        {
+            for (uint32_t i = 0U; i < UART_RX_STATUS_WORDS(length); i++)
+            {
+                error_map[i] = 0U;
+            }
+        }
+#else
+        (void)error_map;
+#endif
+        rx_active = true;
+
+        uart_rx_set_limit((length <= rx_fifo_limit) ? (length - 1U) : rx_fifo_limit);
+        rx_drain_pending = true;
+        NVIC_SetPendingIRQ(UART_RX_IRQn);
+        started = true;
+    }
+
+    UART_FIFO_EXIT_CRITICAL();
+
+    return started;
+}
+
+/*******************************************************************************
+* Function Name: uart_fifo_read
+********************************************************************************
+* Summary:
+* Starts reading into a buffer. The RX interrupt is pended once to pick up
+* data already waiting in the RX FIFO.
+*
+* Parameters:
+*  data:   Buffer for the received data, NULL for the PRBS checker (UART_PRBS_ENABLE)
+*  length: Number of bytes
+*
+* Return:
+*  bool: false if a read is already active, length is zero or data is NULL
+*
+*******************************************************************************/
+bool uart_fifo_read(uint8_t *data, uint32_t length)
+{
+    return uart_rx_start(data, NULL, length);
+}
+
+#if (UART_RX_STATUS_ENABLE == 1)
+/*******************************************************************************
+* Function Name: uart_fifo_read_status
+********************************************************************************
+* Summary:
+* Starts reading into a buffer and records per byte whether it had a parity
+* error: bit (i % 32) of error_map[i / 32] for byte i. The status comes with
+* the data from the same RX FIFO read. Parity must be enabled on the channel.
+*
+* Parameters:
+*  data:      Buffer for the received data
+*  error_map: Parity error map, UART_RX_STATUS_WORDS(length) words
+*  length:    Number of bytes
+*
+* Return:
+*  bool: false if a read is already active, length is zero or data is NULL
+*
+*******************************************************************************/
+bool uart_fifo_read_status(uint8_t *data, uint32_t *error_map, uint32_t length)
+{
+    return uart_rx_start(data, error_map, length);
+}
+#endif
+
+/*******************************************************************************
+* Function Name: uart_fifo_write_abort
+********************************************************************************
+* Summary:
+* Stops an active write. Data already in the TX FIFO is still transmitted.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: Number of bytes moved to the TX FIFO
+*
+*******************************************************************************/
+uint32_t uart_fifo_write_abort(void)
+{
+    uint32_t count;
+
+    UART_FIFO_ENTER_CRITICAL();
+
+    XMC_USIC_CH_TXFIFO_DisableEvent(CYBSP_DEBUG_UART_HW, XMC_USIC_CH_TXFIFO_EVENT_CONF_STANDARD);
+    tx_active = false;
+    count = tx_index;
+
+    UART_FIFO_EXIT_CRITICAL();
+
+    return count;
+}
+
+/*******************************************************************************
+* Function Name: uart_fifo_read_abort
+********************************************************************************
+* Summary:
+* Stops an active read. A pending command escape is dropped with it.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: Number of bytes received
+*
+*******************************************************************************/
+uint32_t uart_fifo_read_abort(void)
+{
+    uint32_t count;
+
+    UART_FIFO_ENTER_CRITICAL();
+
+    rx_active = false;
+#if (UART_STATS_CMD_ENABLE == 1)
+    rx_escaped = false;
+#endif
+    uart_rx_set_limit(UART_RX_IDLE_LIMIT);
+    count = rx_index;
+
+    UART_FIFO_EXIT_CRITICAL();
+
+    return count;
+}
+
+#if (UART_CIPHER_ENABLE == 1)
+/*******************************************************************************
+* Function Name: uart_fifo_resume
+********************************************************************************
+* Summary:
+* Pends the FIFO interrupts of the active transfers, so that a refill or a
+* drain stopped for want of keystream continues.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void uart_fifo_resume(void)
+{
+    if (tx_active)
+    {
+        tx_refill_pending = true;
+        NVIC_SetPendingIRQ(UART_TX_IRQn);
+    }
+    if (rx_active)
+    {
+        rx_drain_pending = true;
+        NVIC_SetPendingIRQ(UART_RX_IRQn);
+    }
+}
+#endif
+
+#if (UART_CRC_ENABLE == 1)
+/*******************************************************************************
+* Function Name: uart_fifo_tx_crc
+********************************************************************************
+* Summary:
+* Returns the CRC of the bytes written so far by the current or last write,
+* before encryption. PRBS data is included.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint16_t
+*
+*******************************************************************************/
+uint16_t uart_fifo_tx_crc(void)
+{
+    return tx_crc;
+}
+
+/*******************************************************************************
+* Function Name: uart_fifo_rx_crc
+********************************************************************************
+* Summary:
+* Returns the CRC of the bytes stored so far by the current or last read,
+* after decryption. PRBS data and command bytes are not included.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint16_t
+*
+*******************************************************************************/
+uint16_t uart_fifo_rx_crc(void)
+{
+    return rx_crc;
+}
+#endif
+
+/*******************************************************************************
+* Function Name: uart_fifo_tx_busy
+********************************************************************************
+* Summary:
+* Returns whether a write is active.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  bool
+*
+*******************************************************************************/
+bool uart_fifo_tx_busy(void)
+{
+    return tx_active;
+}
+
+/*******************************************************************************
+* Function Name: uart_fifo_rx_busy
+********************************************************************************
+* Summary:
+* Returns whether a read is active.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  bool
+*
+*******************************************************************************/
+bool uart_fifo_rx_busy(void)
+{
+    return rx_active;
+}
+
+/*******************************************************************************
+* Function Name: uart_fifo_rx_count
+********************************************************************************
+* Summary:
+* Returns the number of bytes received by the current or last read.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t
+*
+*******************************************************************************/
+uint32_t uart_fifo_rx_count(void)
+{
+    return rx_index;
+}
+
+#if (UART_RX_TIMESTAMP_ENABLE == 1)
+/*******************************************************************************
+* Function Name: uart_fifo_rx_timestamp
+********************************************************************************
+* Summary:
+* Returns the receive time of a byte. The drain timestamp belongs to the last
+* byte in the RX FIFO at entry of the drain; earlier bytes are placed one
+* frame time apart before it. The result is accurate to one frame time plus
+* the interrupt latency at a continuous byte stream, older bytes of a burst
+* with gaps appear later than they were received.
+*
+* Parameters:
+*  byte_number: Byte number, counted by uart_stats.rx_bytes from 0
+*  timestamp: Receive time in ticks of uart_timestamp_frequency()
+*
+* Return:
+*  bool: false if the byte is no longer (or not yet) in the timestamp ring
+*
+*******************************************************************************/
+bool uart_fifo_rx_timestamp(uint32_t byte_number, uint32_t *timestamp)
+{
+    uart_rx_timestamp_t entry;
+    uint32_t entries;
+    uint32_t index;
+    uint32_t n;
+    uint32_t offset = 0U;
+    bool found = false;
+
+    UART_FIFO_ENTER_CRITICAL();
+    entries = (rx_timestamp_head < UART_RX_TIMESTAMP_DEPTH) ? rx_timestamp_head : UART_RX_TIMESTAMP_DEPTH;
+
+    /* Search from the newest drain backwards */
+    for (n = 1U; n <= entries; n++)
+    {
+        entry = rx_timestamps[(rx_timestamp_head - n) & (UART_RX_TIMESTAMP_DEPTH - 1U)];
+        if (byte_number >= (entry.first_byte + entry.count))
+        {
+            /* Not received yet */
+            break;
+        }
+        if (byte_number >= entry.first_byte)
+        {
+            found = true;
+            break;
+        }
+    }
+    UART_FIFO_EXIT_CRITICAL();
+
+    if (found)
+    {
+        /* Bytes received during the drain carry the drain timestamp */
+        index = byte_number - entry.first_byte;
+        if (index < entry.level)
+        {
+            offset = (entry.level - 1U - index) *
+                     (uint32_t)(((uint64_t)uart_timestamp_frequency() * uart_fifo_frame_bits()) /
+                                uart_fifo_baudrate());
+        }
+        *timestamp = (entry.timestamp - offset) & UART_TIMESTAMP_MASK;
+    }
+
+    return found;
+}
+#endif
+
+#if (UART_IRQ_BENCHMARK == 1)
+/*******************************************************************************
+* Function Name: uart_fifo_irq_benchmark
+********************************************************************************
+* Summary:
+* Measures the FIFO interrupts as the interrupted code sees them. Both are
+* pended with interrupts disabled; the cycles from enabling interrupts to the
+* next instruction include exception entry, tail-chaining and exit, which
+* isr_cycles does not. The same sequence without pending is subtracted. The
+* fastest of UART_IRQ_BENCHMARK_RUNS runs is kept. Call at start-up after
+* uart_fifo_init() with no transfer active; the counters are restored.
+*
+* Parameters:
+*  result: Cycles of the fastest run
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void uart_fifo_irq_benchmark(uart_fifo_irq_benchmark_t *result)
+{
+    uart_stats_t stats = uart_stats;
+    uint32_t primask = __get_PRIMASK();
+    uint32_t reference = UINT32_MAX;
+    uint32_t total = UINT32_MAX;
+    uint32_t handler = 0U;
+#if (UART_TRACE_ENABLE == 1)
+    uint32_t head = uart_trace_buffer.head;
+#endif
+
+    for (uint32_t run = 0U; run < UART_IRQ_BENCHMARK_RUNS; run++)
+    {
+        uint32_t start;
+        uint32_t cycles;
+
+        __disable_irq();
+        start = uart_cycles_now();
+        __enable_irq();
+        __ISB();
+        cycles = uart_cycles_elapsed(start);
+        if (cycles < reference)
+        {
+            reference = cycles;
+        }
+
+        __disable_irq();
+        uart_stats.isr_cycles = 0U;
+        NVIC_SetPendingIRQ(UART_TX_IRQn);
+        NVIC_SetPendingIRQ(UART_RX_IRQn);
+        start = uart_cycles_now();
+        __enable_irq();
+        __ISB();
+        cycles = uart_cycles_elapsed(start);
+        if (cycles < total)
+        {
+            total = cycles;
+            handler = uart_stats.isr_cycles;
+        }
+    }
+
+    __set_PRIMASK(primask);
+    uart_stats = stats;
+#if (UART_TRACE_ENABLE == 1)
+    uart_trace_buffer.head = head;
+#endif
+
+    result->total_cycles = (total > reference) ? (total - reference) : 0U;
+    result->handler_cycles = handler;
+    result->overhead_cycles = (result->total_cycles > handler) ? (result->total_cycles - handler) : 0U;
+}
+#endif
+
+/* [] END OF FILE */
@@ -0,0 +1,144 @@
+/******************************************************************************
+* File Name:   uart_fifo.h
+*
+* Description: This file contains the interface of the interrupt driven UART
+*              FIFO driver. Transfers are started with a buffer and a length;
+*              the TX and RX FIFO limit interrupts move the data.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#ifndef UART_FIFO_H_
+#define UART_FIFO_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "uart_config.h"
+#include "uart_stats.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+/* Transfer completion callback, called from interrupt context */
+typedef void (*uart_fifo_callback_t)(void);
+
+#if (UART_RX_TIMESTAMP_ENABLE == 1)
+/* One RX FIFO drain: the timestamp is taken at entry of the drain, when the
+ * last of the 'level' bytes in the RX FIFO has just been received
+ */
+typedef struct
+{
+    uint32_t timestamp;         /* uart_timestamp_now() at entry of the drain */
+    uint32_t first_byte;        /* Byte number (uart_stats.rx_bytes) of the first byte read */
+    uint8_t level;              /* RX FIFO level at entry of the drain */
+    uint8_t count;              /* Bytes read by the drain */
+} uart_rx_timestamp_t;
+#endif
+
+#if (UART_IRQ_BENCHMARK == 1)
+/* A TX and an RX FIFO interrupt pended together: two handlers tail-chained,
+ * or one entry of the combined handler
+ */
+typedef struct
+{
+    uint32_t total_cycles;      /* From pending to the return to thread mode */
+    uint32_t handler_cycles;    /* Of those inside the handlers, as counted in isr_cycles */
+    uint32_t overhead_cycles;   /* Exception entry, tail-chaining and exit */
+} uart_fifo_irq_benchmark_t;
+#endif
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Interrupt and byte counters */
+extern uart_stats_t uart_stats;
+
+#if (UART_STATS_CMD_ENABLE == 1)
+/* Data bytes received without an active read and invalid escape sequences */
+extern uint32_t uart_fifo_rx_discarded;
+extern uint32_t uart_fifo_rx_invalid;
+#endif
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void uart_fifo_init(void);
+void uart_fifo_register_callbacks(uart_fifo_callback_t tx_done, uart_fifo_callback_t rx_done);
+#if (UART_STATS_CMD_ENABLE == 1)
+void uart_fifo_register_command(uart_fifo_callback_t command);
+#endif
+void uart_fifo_set_limits(uint32_t tx_limit, uint32_t rx_limit);
+void uart_fifo_get_limits(uint32_t *tx_limit, uint32_t *rx_limit);
+void uart_fifo_set_baudrate(uint32_t baudrate);
+uint32_t uart_fifo_baudrate(void);
+uint32_t uart_fifo_frame_bits(void);
+bool uart_fifo_set_sizes(uint32_t tx_words, uint32_t rx_words);
+#if (UART_COALESCE_LATENCY_US != 0U)
+bool uart_fifo_start_timer(uint32_t period_us);
+#endif
+
+bool uart_fifo_write(const uint8_t *data, uint32_t length);
+bool uart_fifo_read(uint8_t *data, uint32_t length);
+#if (UART_RX_STATUS_ENABLE == 1)
+bool uart_fifo_read_status(uint8_t *data, uint32_t *error_map, uint32_t length);
+#endif
+uint32_t uart_fifo_write_abort(void);
+uint32_t uart_fifo_read_abort(void);
+bool uart_fifo_tx_busy(void);
+bool uart_fifo_rx_busy(void);
+uint32_t uart_fifo_rx_count(void);
+#if (UART_CIPHER_ENABLE == 1)
+void uart_fifo_resume(void);
+#endif
+#if (UART_CRC_ENABLE == 1)
+uint16_t uart_fifo_tx_crc(void);
+uint16_t uart_fifo_rx_crc(void);
+#endif
+#if (UART_RX_TIMESTAMP_ENABLE == 1)
+bool uart_fifo_rx_timestamp(uint32_t byte_number, uint32_t *timestamp);
+#endif
+#if (UART_IRQ_BENCHMARK == 1)
+void uart_fifo_irq_benchmark(uart_fifo_irq_benchmark_t *result);
+#endif
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* UART_FIFO_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,219 @@
+/******************************************************************************
+* File Name:   uart_fifo_ram.c
+*
+* Description: This file contains the FIFO RAM allocator. FIFO buffers have a
+*              power of two size and are placed at a multiple of their size, so
+*              the free space stays usable for large buffers.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#include "uart_fifo_ram.h"
+
+/*******************************************************************************
+*  Global Variables
+*******************************************************************************/
+uart_fifo_ram_t uart_fifo_ram_usic0;
+
+/*******************************************************************************
+* Function Name: uart_fifo_ram_is_free
+********************************************************************************
+* Summary:
+* Checks whether a range of FIFO RAM words is unused.
+*
+* Parameters:
+*  ram:     FIFO RAM of a USIC module
+*  pointer: First word
+*  words:   Number of words
+*
+* Return:
+*  bool
+*
+*******************************************************************************/
+static bool uart_fifo_ram_is_free(const uart_fifo_ram_t *ram, uint32_t pointer, uint32_t words)
+{
+    for (uint32_t word = pointer; word < (pointer + words); word++)
+    {
+        if ((ram->used[word / 32U] & (1UL << (word % 32U))) != 0U)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: uart_fifo_ram_mark
+********************************************************************************
+* Summary:
+* Marks a range of FIFO RAM words as used or unused.
+*
+* Parameters:
+*  ram:     FIFO RAM of a USIC module
+*  pointer: First word
+*  words:   Number of words
+*  used:    New state
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void uart_fifo_ram_mark(uart_fifo_ram_t *ram, uint32_t pointer, uint32_t words, bool used)
+{
+    for (uint32_t word = pointer; word < (pointer + words); word++)
+    {
+        if (used)
+        {
+            ram->used[word / 32U] |= 1UL << (word % 32U);
+        }
+        else
+        {
+            ram->used[word / 32U] &= ~(1UL << (word % 32U));
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: uart_fifo_ram_reserve
+********************************************************************************
+* Summary:
+* Marks a FIFO buffer configured elsewhere, for example in design.modus, as
+* used.
+*
+* Parameters:
+*  ram:     FIFO RAM of a USIC module
+*  pointer: Data pointer of the buffer
+*  words:   Buffer size in words
+*
+* Return:
+*  bool: false if the range is outside the FIFO RAM or overlaps a buffer
+*
+*******************************************************************************/
+bool uart_fifo_ram_reserve(uart_fifo_ram_t *ram, uint32_t pointer, uint32_t words)
+{
+    if ((words == 0U) || (pointer >= UART_FIFO_RAM_WORDS) || (words > (UART_FIFO_RAM_WORDS - pointer)) ||
+        !uart_fifo_ram_is_free(ram, pointer, words))
+    {
+        return false;
+    }
+
+    uart_fifo_ram_mark(ram, pointer, words, true);
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: uart_fifo_ram_alloc
+********************************************************************************
+* Summary:
+* Allocates a FIFO buffer at the lowest free multiple of its size.
+*
+* Parameters:
+*  ram:     FIFO RAM of a USIC module
+*  words:   Buffer size in words, a power of two from 2 to 64
+*  pointer: Data pointer of the buffer
+*
+* Return:
+*  bool: false if the size is invalid or no aligned range is free
+*
+*******************************************************************************/
+bool uart_fifo_ram_alloc(uart_fifo_ram_t *ram, uint32_t words, uint32_t *pointer)
+{
+    if ((words < 2U) || (words > UART_FIFO_RAM_WORDS) || ((words & (words - 1U)) != 0U))
+    {
+        return false;
+    }
+
+    for (uint32_t start = 0U; start < UART_FIFO_RAM_WORDS; start += words)
+    {
+        if (uart_fifo_ram_is_free(ram, start, words))
+        {
+            uart_fifo_ram_mark(ram, start, words, true);
+            *pointer = start;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*******************************************************************************
+* Function Name: uart_fifo_ram_free
+********************************************************************************
+* Summary:
+* Releases a FIFO buffer.
+*
+* Parameters:
+*  ram:     FIFO RAM of a USIC module
+*  pointer: Data pointer of the buffer
+*  words:   Buffer size in words
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void uart_fifo_ram_free(uart_fifo_ram_t *ram, uint32_t pointer, uint32_t words)
+{
+    if ((pointer < UART_FIFO_RAM_WORDS) && (words <= (UART_FIFO_RAM_WORDS - pointer)))
+    {
+        uart_fifo_ram_mark(ram, pointer, words, false);
+    }
+}
+
+/*******************************************************************************
+* Function Name: uart_fifo_ram_available
+********************************************************************************
+* Summary:
+* Returns the number of unused FIFO RAM words.
+*
+* Parameters:
+*  ram: FIFO RAM of a USIC module
+*
+* Return:
+*  uint32_t
+*
+*******************************************************************************/
+uint32_t uart_fifo_ram_available(const uart_fifo_ram_t *ram)
+{
+    uint32_t available = 0U;
+
+    for (uint32_t word = 0U; word < UART_FIFO_RAM_WORDS; word++)
+    {
+        if ((ram->used[word / 32U] & (1UL << (word % 32U))) == 0U)
+        {
+            available++;
+        }
+    }
+    return available;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,86 @@
+/******************************************************************************
+* File Name:   uart_fifo_ram.h
+*
+* Description: This file contains the interface of the FIFO RAM allocator. The
+*              64 words of FIFO RAM of a USIC module are shared by the TX and RX
+*              FIFOs of its channels.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#ifndef UART_FIFO_RAM_H_
+#define UART_FIFO_RAM_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+/* FIFO RAM words of a USIC module */
+#define UART_FIFO_RAM_WORDS             64U
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+/* Allocation state of the FIFO RAM of one USIC module, one bit per word */
+typedef struct
+{
+    uint32_t used[UART_FIFO_RAM_WORDS / 32U];
+} uart_fifo_ram_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* FIFO RAM of USIC0, the module of the debug UART */
+extern uart_fifo_ram_t uart_fifo_ram_usic0;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+bool uart_fifo_ram_reserve(uart_fifo_ram_t *ram, uint32_t pointer, uint32_t words);
+bool uart_fifo_ram_alloc(uart_fifo_ram_t *ram, uint32_t words, uint32_t *pointer);
+void uart_fifo_ram_free(uart_fifo_ram_t *ram, uint32_t pointer, uint32_t words);
+uint32_t uart_fifo_ram_available(const uart_fifo_ram_t *ram);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* UART_FIFO_RAM_H_ */
+
+/* [] END OF FILE */
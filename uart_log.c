@@ -0,0 +1,379 @@
+/******************************************************************************
+* File Name:   uart_log.c
+*
+* Description: This file contains the deferred log. The main loop takes the records
+*              from the ring, formats them as text lines or packs them as binary
+*              frames for tools/uart_log_decode.c, and queues them as bulk data.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#include "uart_log.h"
+#include "uart_async.h"
+
+#if (UART_LOG_ENABLE == 1)
+
+#if defined(COMPONENT_FREERTOS)
+#error "The deferred log sends through the asynchronous API, which is not built with FreeRTOS"
+#endif
+
+#if ((UART_LOG_DEPTH & (UART_LOG_DEPTH - 1U)) != 0U)
+#error "UART_LOG_DEPTH must be a power of two"
+#endif
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+/* Longest text line, longer lines are cut */
+#define UART_LOG_LINE_MAX               80U
+
+#define UART_LOG_FORMAT(id, format)     format,
+
+#if (UART_LOG_BINARY == 1) && (UART_LOG_TX_SIZE < UART_LOG_FRAME_MAX)
+#error "UART_LOG_TX_SIZE must hold one frame"
+#elif (UART_LOG_BINARY == 0) && (UART_LOG_TX_SIZE < (UART_LOG_LINE_MAX + 2U))
+#error "UART_LOG_TX_SIZE must hold one line"
+#endif
+
+/*******************************************************************************
+*  Global Variables
+*******************************************************************************/
+uart_log_ring_t uart_log_ring;
+
+#if (UART_LOG_BINARY == 0)
+static const char *const uart_log_formats[UART_LOG_FORMAT_COUNT] =
+{
+    UART_LOG_FORMATS(UART_LOG_FORMAT)
+};
+#endif
+
+/* Frames or lines of one batch, sent with a single request */
+static uint8_t log_tx[UART_LOG_TX_SIZE];
+static volatile bool log_tx_busy;
+
+/*******************************************************************************
+* Function Name: uart_log_tx_done
+********************************************************************************
+* Summary:
+* Write completion callback, called from PendSV. Frees the batch buffer.
+*
+* Parameters:
+*  buffer: Sent data
+*  length: Number of bytes sent
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void uart_log_tx_done(const uint8_t *buffer, uint32_t length)
+{
+    (void)buffer;
+    (void)length;
+
+    log_tx_busy = false;
+}
+
+#if (UART_LOG_BINARY == 1)
+/*******************************************************************************
+* Function Name: uart_log_pack
+********************************************************************************
+* Summary:
+* Packs a record as binary frame.
+*
+* Parameters:
+*  record: Record
+*  frame:  Frame of at least UART_LOG_FRAME_MAX bytes
+*
+* Return:
+*  uint32_t: Frame length
+*
+*******************************************************************************/
+static uint32_t uart_log_pack(const uart_log_record_t *record, uint8_t *frame)
+{
+    uint32_t length = 0U;
+    uint8_t sum = 0U;
+
+    frame[length++] = UART_LOG_FRAME_SYNC;
+    frame[length++] = record->id;
+    frame[length++] = record->argc;
+    for (uint32_t shift = 0U; shift < 32U; shift += 8U)
+    {
+        frame[length++] = (uint8_t)(record->timestamp >> shift);
+    }
+    for (uint32_t arg = 0U; arg < record->argc; arg++)
+    {
+        for (uint32_t shift = 0U; shift < 32U; shift += 8U)
+        {
+            frame[length++] = (uint8_t)(record->args[arg] >> shift);
+        }
+    }
+    for (uint32_t i = 0U; i < length; i++)
+    {
+        sum += frame[i];
+    }
+    frame[length++] = (uint8_t)(0U - sum);
+
+    return length;
+}
+#else
+/*******************************************************************************
+* Function Name: uart_log_number
+********************************************************************************
+* Summary:
+* Appends a number to a text line.
+*
+* Parameters:
+*  line:  Text line
+*  pos:   Write position
+*  value: Number
+*  base:  10 or 16
+*  upper: Upper case hexadecimal digits
+*  width: Minimum number of characters
+*  pad:   Padding character
+*
+* Return:
+*  uint32_t: New write position
+*
+*******************************************************************************/
+static uint32_t uart_log_number(char *line, uint32_t pos, uint32_t value, uint32_t base,
+                                bool upper, uint32_t width, char pad)
+{
+    const char *digits = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+    char text[10];
+    uint32_t count = 0U;
+
+    do
+    {
+        text[count++] = digits[value % base];
+        value /= base;
+    } while (value != 0U);
+
+    while ((width > count) && (pos < UART_LOG_LINE_MAX))
+    {
+        line[pos++] = pad;
+        width--;
+    }
+    while ((count != 0U) && (pos < UART_LOG_LINE_MAX))
+    {
+        line[pos++] = text[--count];
+    }
+
+    return pos;
+}
+
+/*******************************************************************************
+* Function Name: uart_log_format
+********************************************************************************
+* Summary:
+* Formats a record as text line terminated by CR LF.
+*
+* Parameters:
+*  record: Record
+*  line:   Text line of UART_LOG_LINE_MAX + 2 characters
+*
+* Return:
+*  uint32_t: Line length
+*
+*******************************************************************************/
+static uint32_t uart_log_format(const uart_log_record_t *record, char *line)
+{
+    const char *format = (record->id < UART_LOG_FORMAT_COUNT) ? uart_log_formats[record->id] : "?";
+    uint32_t pos = 0U;
+    uint32_t arg = 0U;
+
+    while ((*format != '\0') && (pos < UART_LOG_LINE_MAX))
+    {
+        uint32_t width = 0U;
+        uint32_t value;
+        char pad = ' ';
+
+        if (*format != '%')
+        {
+            line[pos++] = *format++;
+            continue;
+        }
+
+        format++;
+        if (*format == '0')
+        {
+            pad = '0';
+            format++;
+        }
+        while ((*format >= '0') && (*format <= '9'))
+        {
+            width = (width * 10U) + (uint32_t)(*format++ - '0');
+        }
+
+        value = (arg < record->argc) ? record->args[arg] : 0U;
+        switch (*format)
+        {
+            case 'u':
+                pos = uart_log_number(line, pos, value, 10U, false, width, pad);
+                arg++;
+                break;
+            case 'd':
+                if (((int32_t)value < 0) && (pos < UART_LOG_LINE_MAX))
+                {
+                    line[pos++] = '-';
+                    value = 0U - value;
+                    width = (width != 0U) ? (width - 1U) : 0U;
+                }
+                pos = uart_log_number(line, pos, value, 10U, false, width, pad);
+                arg++;
+                break;
+            case 'x':
+            case 'X':
+                pos = uart_log_number(line, pos, value, 16U, *format == 'X', width, pad);
+                arg++;
+                break;
+            case 'c':
+                line[pos++] = (char)value;
+                arg++;
+                break;
+            case '\0':
+                format--;
+                break;
+            default:
+                line[pos++] = *format;
+                break;
+        }
+        format++;
+    }
+
+    line[pos++] = '\r';
+    line[pos++] = '\n';
+
+    return pos;
+}
+#endif
+
+/*******************************************************************************
+* Function Name: uart_log_benchmark
+********************************************************************************
+* Summary:
+* Measures UART_LOG3() by filling the empty ring, then removes the records
+* again. Call at start-up before anything is logged.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: CPU cycles per record, including the loop
+*
+*******************************************************************************/
+uint32_t uart_log_benchmark(void)
+{
+    uint32_t head = uart_log_ring.head;
+    uint32_t start;
+    uint32_t cycles;
+
+    uart_cycles_init();
+
+    start = uart_cycles_now();
+    for (uint32_t i = 0U; i < UART_LOG_DEPTH; i++)
+    {
+        UART_LOG3(UART_LOG_START, i, head, start);
+    }
+    cycles = uart_cycles_elapsed(start);
+
+    uart_log_ring.head = head;
+
+    return cycles / UART_LOG_DEPTH;
+}
+
+/*******************************************************************************
+* Function Name: uart_log_process
+********************************************************************************
+* Summary:
+* Background part of the log, call it from the main loop. If the previous
+* batch has been sent, the waiting records are formatted (or packed) into
+* the batch buffer and queued as bulk data. Records that do not fit, or
+* do not find room in the TX queue, wait for the next call.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void uart_log_process(void)
+{
+    uint32_t length = 0U;
+    uint32_t tail = uart_log_ring.tail;
+
+    if (log_tx_busy)
+    {
+        return;
+    }
+
+    while (tail != uart_log_ring.head)
+    {
+        const uart_log_record_t *record = &uart_log_ring.records[tail & (UART_LOG_DEPTH - 1U)];
+#if (UART_LOG_BINARY == 1)
+        uint8_t entry[UART_LOG_FRAME_MAX];
+        uint32_t size = uart_log_pack(record, entry);
+#else
+        char entry[UART_LOG_LINE_MAX + 2U];
+        uint32_t size = uart_log_format(record, entry);
+#endif
+
+        if ((length + size) > UART_LOG_TX_SIZE)
+        {
+            break;
+        }
+        for (uint32_t i = 0U; i < size; i++)
+        {
+            log_tx[length++] = (uint8_t)entry[i];
+        }
+        tail++;
+    }
+
+    if (length != 0U)
+    {
+        /* The callback may run before the request function returns */
+        log_tx_busy = true;
+        if (uart_tx_async_priority(log_tx, length, UART_ASYNC_PRIORITY_BULK, uart_log_tx_done) == UART_ASYNC_SUCCESS)
+        {
+            uart_log_ring.tail = tail;
+        }
+        else
+        {
+            log_tx_busy = false;
+        }
+    }
+}
+
+#endif
+
+/* [] END OF FILE */
@@ -0,0 +1,175 @@
+/******************************************************************************
+* File Name:   uart_log.h
+*
+* Description: This file contains the interface of the deferred log. Call sites
+*              store a format ID and raw arguments into a ring; the main loop
+*              formats or packs them later and sends them over the debug UART.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#ifndef UART_LOG_H_
+#define UART_LOG_H_
+
+#include <stdint.h>
+#include "uart_config.h"
+#include "uart_log_formats.h"
+
+#if !defined(UART_LOG_HOST_BUILD)
+#include "xmc_common.h"
+#include "uart_cycles.h"
+#endif
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+/* Arguments per record */
+#define UART_LOG_MAX_ARGS               3U
+
+/* Binary frame: sync, ID, argument count, timestamp, arguments (32-bit little
+ * endian each) and a checksum making the sum of all bytes zero
+ */
+#define UART_LOG_FRAME_SYNC             0xA5U
+#define UART_LOG_FRAME_HEADER           7U
+#define UART_LOG_FRAME_MAX              (UART_LOG_FRAME_HEADER + (4U * UART_LOG_MAX_ARGS) + 1U)
+
+#define UART_LOG_ENUM(id, format)       id,
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+typedef enum
+{
+    UART_LOG_FORMATS(UART_LOG_ENUM)
+    UART_LOG_FORMAT_COUNT
+} uart_log_id_t;
+
+typedef struct
+{
+    uint32_t timestamp;         /* uart_cycles_now() */
+    uint8_t id;                 /* uart_log_id_t */
+    uint8_t argc;               /* Arguments used */
+    uint32_t args[UART_LOG_MAX_ARGS];
+} uart_log_record_t;
+
+typedef struct
+{
+    volatile uint32_t head;     /* Records written */
+    volatile uint32_t tail;     /* Records sent */
+    volatile uint32_t dropped;  /* Records lost to a full ring */
+    uart_log_record_t records[UART_LOG_DEPTH];
+} uart_log_ring_t;
+
+#if !defined(UART_LOG_HOST_BUILD)
+#if (UART_LOG_ENABLE == 1)
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+extern uart_log_ring_t uart_log_ring;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void uart_log_process(void);
+uint32_t uart_log_benchmark(void);
+
+/*******************************************************************************
+* Function Name: uart_log_write
+********************************************************************************
+* Summary:
+* Stores one record. Nothing is formatted here; the slot is claimed and
+* filled with interrupts disabled, so interrupts and the main loop can log
+* concurrently. When the ring is full the record is dropped and counted.
+* uart_log_benchmark() measures the cycles per call.
+*
+* Parameters:
+*  id:   Format ID (uart_log_id_t)
+*  argc: Arguments used
+*  arg0: First argument
+*  arg1: Second argument
+*  arg2: Third argument
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static inline void uart_log_write(uint32_t id, uint32_t argc, uint32_t arg0, uint32_t arg1, uint32_t arg2)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint32_t head;
+
+    __disable_irq();
+    head = uart_log_ring.head;
+    if ((head - uart_log_ring.tail) < UART_LOG_DEPTH)
+    {
+        uart_log_record_t *record = &uart_log_ring.records[head & (UART_LOG_DEPTH - 1U)];
+
+        record->timestamp = uart_cycles_now();
+        record->id = (uint8_t)id;
+        record->argc = (uint8_t)argc;
+        record->args[0] = arg0;
+        record->args[1] = arg1;
+        record->args[2] = arg2;
+        uart_log_ring.head = head + 1U;
+    }
+    else
+    {
+        uart_log_ring.dropped++;
+    }
+    __set_PRIMASK(primask);
+}
+
+#define UART_LOG0(id)                   uart_log_write((id), 0U, 0U, 0U, 0U)
+#define UART_LOG1(id, a)                uart_log_write((id), 1U, (uint32_t)(a), 0U, 0U)
+#define UART_LOG2(id, a, b)             uart_log_write((id), 2U, (uint32_t)(a), (uint32_t)(b), 0U)
+#define UART_LOG3(id, a, b, c)          uart_log_write((id), 3U, (uint32_t)(a), (uint32_t)(b), (uint32_t)(c))
+#else
+/* The arguments are not evaluated, sizeof only keeps their variables in use */
+#define UART_LOG0(id)                   ((void)0)
+#define UART_LOG1(id, a)                ((void)sizeof(a))
+#define UART_LOG2(id, a, b)             ((void)sizeof(a), (void)sizeof(b))
+#define UART_LOG3(id, a, b, c)          ((void)sizeof(a), (void)sizeof(b), (void)sizeof(c))
+#endif
+#endif
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* UART_LOG_H_ */
+
+/* [] END OF FILE */
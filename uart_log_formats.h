@@ -0,0 +1,59 @@
+/******************************************************************************
+* File Name:   uart_log_formats.h
+*
+* Description: This file contains the format strings of the deferred log. The
+*              list is shared by the firmware and the host decoder; the position in
+*              the list is the format ID sent on the link, so add new formats at
+*              the end.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#ifndef UART_LOG_FORMATS_H_
+#define UART_LOG_FORMATS_H_
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+/* X(id, format): the formats take up to UART_LOG_MAX_ARGS 32-bit arguments and
+ * support the conversions %u, %d, %x, %X, %c and %% with an optional zero
+ * flag and width, for example %08x
+ */
+#define UART_LOG_FORMATS(X) \
+    X(UART_LOG_START,       "start, %u baud") \
+    X(UART_LOG_SELFTEST,    "self-test status %u, %u errors, %u bit/s") \
+    X(UART_LOG_VERIFY,      "verify, %u of %u bytes wrong")
+
+#endif /* UART_LOG_FORMATS_H_ */
+
+/* [] END OF FILE */
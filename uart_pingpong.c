@@ -0,0 +1,303 @@
+/******************************************************************************
+* File Name:   uart_pingpong.c
+*
+* Description: This file contains the double-buffered RX. The buffers are filled
+*              in turn, so the ownership of each buffer passes between the RX
+*              interrupt and the main loop with a single store, without a
+*              critical section and without copying the data.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#include "xmc_common.h"
+#include "uart_pingpong.h"
+#include "uart_fifo.h"
+#include "uart_cycles.h"
+
+#if (UART_PINGPONG_ENABLE == 1)
+#if (UART_STATS_CMD_ENABLE == 1) || (UART_SOAK_ENABLE == 1) || (UART_PRBS_ENABLE == 1)
+#error "The ping-pong benchmark cannot be combined with the stats command, the soak test or the PRBS link test"
+#endif
+#endif
+
+/*******************************************************************************
+*  Global Variables
+*******************************************************************************/
+volatile uint32_t uart_pingpong_stalls;
+
+static uint8_t *pingpong_buffer[2];
+static uint32_t pingpong_length;
+
+/* Set by the RX interrupt when a buffer is full, cleared by the consumer
+ * when it releases the buffer
+ */
+static volatile bool pingpong_full[2];
+
+/* No read is active because the next buffer is still owned by the consumer */
+static volatile bool pingpong_stalled;
+
+/* Buffer being filled, only used by the RX interrupt */
+static uint32_t pingpong_fill;
+
+/* Buffer processed next, only used by the consumer */
+static uint32_t pingpong_consume;
+
+#if (UART_PINGPONG_ENABLE == 1)
+uart_pingpong_stats_t uart_pingpong_stats;
+
+static uint8_t pingpong_rx[2][UART_PINGPONG_LENGTH];
+static uint8_t pingpong_tx[UART_PINGPONG_LENGTH];
+static uint8_t pingpong_tx_next;
+static uint8_t pingpong_rx_next;
+static uint32_t pingpong_last;
+#endif
+
+/*******************************************************************************
+* Function Name: uart_pingpong_rx_done
+********************************************************************************
+* Summary:
+* Read completion callback, called from the RX interrupt. Hands the full
+* buffer to the consumer and continues in the other buffer if the consumer
+* has released it; otherwise the data waits in the RX FIFO until then.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void uart_pingpong_rx_done(void)
+{
+    pingpong_full[pingpong_fill] = true;
+    pingpong_fill ^= 1U;
+
+    if (!pingpong_full[pingpong_fill])
+    {
+        (void)uart_fifo_read(pingpong_buffer[pingpong_fill], pingpong_length);
+    }
+    else
+    {
+        pingpong_stalled = true;
+        uart_pingpong_stalls++;
+    }
+}
+
+/*******************************************************************************
+* Function Name: uart_pingpong_init
+********************************************************************************
+* Summary:
+* Starts the reception into two alternating buffers. The FIFO driver is used
+* directly, so the completion callbacks of the asynchronous API are removed.
+*
+* Parameters:
+*  buffer_a: First buffer
+*  buffer_b: Second buffer
+*  length:   Bytes per buffer
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void uart_pingpong_init(uint8_t *buffer_a, uint8_t *buffer_b, uint32_t length)
+{
+    pingpong_buffer[0] = buffer_a;
+    pingpong_buffer[1] = buffer_b;
+    pingpong_length = length;
+    pingpong_full[0] = false;
+    pingpong_full[1] = false;
+    pingpong_stalled = false;
+    pingpong_fill = 0U;
+    pingpong_consume = 0U;
+
+    uart_fifo_register_callbacks(NULL, uart_pingpong_rx_done);
+    (void)uart_fifo_read(buffer_a, length);
+}
+
+/*******************************************************************************
+* Function Name: uart_pingpong_acquire
+********************************************************************************
+* Summary:
+* Returns the next full buffer. The buffer belongs to the caller until
+* uart_pingpong_release(); buffers are returned in reception order.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint8_t *: Full buffer, NULL if the next buffer is still being filled
+*
+*******************************************************************************/
+uint8_t *uart_pingpong_acquire(void)
+{
+    if (!pingpong_full[pingpong_consume])
+    {
+        return NULL;
+    }
+
+    /* The buffer contents are read after the ownership */
+    __DMB();
+    return pingpong_buffer[pingpong_consume];
+}
+
+/*******************************************************************************
+* Function Name: uart_pingpong_release
+********************************************************************************
+* Summary:
+* Returns the buffer from uart_pingpong_acquire() to the RX interrupt. If the
+* reception stalled on this buffer, it is restarted here. The RX interrupt
+* cannot complete a read in between, since no read is active while stalled.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void uart_pingpong_release(void)
+{
+    uint32_t released = pingpong_consume;
+
+    pingpong_consume ^= 1U;
+
+    /* The buffer contents are processed before the ownership is returned */
+    __DMB();
+    pingpong_full[released] = false;
+
+    if (pingpong_stalled)
+    {
+        pingpong_stalled = false;
+        (void)uart_fifo_read(pingpong_buffer[released], pingpong_length);
+    }
+}
+
+#if (UART_PINGPONG_ENABLE == 1)
+/*******************************************************************************
+* Function Name: uart_pingpong_benchmark_init
+********************************************************************************
+* Summary:
+* Starts the benchmark: a counter sequence is sent continuously and received
+* into two buffers of UART_PINGPONG_LENGTH bytes.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void uart_pingpong_benchmark_init(void)
+{
+    uart_pingpong_init(pingpong_rx[0], pingpong_rx[1], UART_PINGPONG_LENGTH);
+    pingpong_last = uart_cycles_now();
+}
+
+/*******************************************************************************
+* Function Name: uart_pingpong_benchmark_iteration
+********************************************************************************
+* Summary:
+* Keeps the TX busy with the counter sequence and processes the next full
+* buffer, if any: the sequence is verified and UART_PINGPONG_CONSUMER_CYCLES
+* are spent as processing time. The time is accumulated while polling, so the
+* SysTick period of XMC1 does not limit the run length.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  bool: false if the processed buffer broke the counter sequence
+*
+*******************************************************************************/
+bool uart_pingpong_benchmark_iteration(void)
+{
+    uint8_t *buffer;
+    uint32_t errors = 0U;
+    uint32_t now;
+    uint64_t run_ms;
+
+    if (!uart_fifo_tx_busy())
+    {
+        for (uint32_t i = 0U; i < UART_PINGPONG_LENGTH; i++)
+        {
+            pingpong_tx[i] = pingpong_tx_next++;
+        }
+        (void)uart_fifo_write(pingpong_tx, UART_PINGPONG_LENGTH);
+    }
+
+    buffer = uart_pingpong_acquire();
+    if (buffer != NULL)
+    {
+        uint32_t busy = 0U;
+        uint32_t last = uart_cycles_now();
+
+        /* Bytes lost in an RX FIFO overflow break the sequence once */
+        for (uint32_t i = 0U; i < UART_PINGPONG_LENGTH; i++)
+        {
+            if (buffer[i] != pingpong_rx_next)
+            {
+                errors++;
+            }
+            pingpong_rx_next = buffer[i] + 1U;
+        }
+
+        while (busy < UART_PINGPONG_CONSUMER_CYCLES)
+        {
+            now = uart_cycles_now();
+            busy += uart_cycles_between(last, now);
+            last = now;
+        }
+
+        uart_pingpong_release();
+
+        uart_pingpong_stats.buffers++;
+        uart_pingpong_stats.errors += errors;
+        uart_pingpong_stats.bytes += UART_PINGPONG_LENGTH;
+    }
+
+    now = uart_cycles_now();
+    uart_pingpong_stats.cycles += uart_cycles_between(pingpong_last, now);
+    pingpong_last = now;
+
+    /* Milliseconds keep the products within 64 bits on multi-hour runs */
+    run_ms = uart_pingpong_stats.cycles / (SystemCoreClock / 1000U);
+    if (run_ms != 0U)
+    {
+        uart_pingpong_stats.throughput_bps = (uint32_t)((uart_pingpong_stats.bytes * 8000U) / run_ms);
+    }
+
+    return errors == 0U;
+}
+#endif
+
+/* [] END OF FILE */
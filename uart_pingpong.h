@@ -0,0 +1,105 @@
+/******************************************************************************
+* File Name:   uart_pingpong.h
+*
+* Description: This file contains the interface of the double-buffered RX. The
+*              RX interrupt fills one buffer while the main loop processes the
+*              other.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#ifndef UART_PINGPONG_H_
+#define UART_PINGPONG_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "uart_config.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+/* Bytes per buffer of the benchmark */
+#ifndef UART_PINGPONG_LENGTH
+#define UART_PINGPONG_LENGTH            64U
+#endif
+
+/* Processing time per buffer of the benchmark consumer in CPU cycles */
+#ifndef UART_PINGPONG_CONSUMER_CYCLES
+#define UART_PINGPONG_CONSUMER_CYCLES   20000U
+#endif
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+typedef struct
+{
+    uint32_t buffers;           /* Buffers processed */
+    uint32_t errors;            /* Bytes breaking the counter sequence */
+    uint64_t bytes;             /* Bytes processed */
+    uint64_t cycles;            /* CPU cycles of the run */
+    uint32_t throughput_bps;    /* Processed bits per second over the run */
+} uart_pingpong_stats_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Receptions held back because the consumer owned both buffers */
+extern volatile uint32_t uart_pingpong_stalls;
+
+#if (UART_PINGPONG_ENABLE == 1)
+extern uart_pingpong_stats_t uart_pingpong_stats;
+#endif
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void uart_pingpong_init(uint8_t *buffer_a, uint8_t *buffer_b, uint32_t length);
+uint8_t *uart_pingpong_acquire(void);
+void uart_pingpong_release(void);
+
+#if (UART_PINGPONG_ENABLE == 1)
+void uart_pingpong_benchmark_init(void);
+bool uart_pingpong_benchmark_iteration(void);
+#endif
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* UART_PINGPONG_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,136 @@
+/******************************************************************************
+* File Name:   uart_prbs.c
+*
+* Description: This file contains the state of the PRBS link test and the
+*              throughput benchmark of the generator and the checker.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#include "uart_prbs.h"
+#include "uart_cycles.h"
+
+#if (UART_PRBS_ENABLE == 1)
+
+#if (UART_SOAK_ENABLE == 1)
+#error "The PRBS link test cannot be combined with the soak test"
+#endif
+
+/*******************************************************************************
+*  Global Variables
+*******************************************************************************/
+uart_prbs_t uart_prbs_generator;
+uart_prbs_checker_t uart_prbs_checker;
+
+/*******************************************************************************
+* Function Name: uart_prbs_setup
+********************************************************************************
+* Summary:
+* Selects the sequence of a generator and seeds it with all ones.
+*
+* Parameters:
+*  prbs:  Generator
+*  order: Sequence
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void uart_prbs_setup(uart_prbs_t *prbs, uart_prbs_order_t order)
+{
+    prbs->order = (uint32_t)order;
+    prbs->shift = (order == UART_PRBS_31) ? 3U : 1U;
+    prbs->state = (1UL << prbs->order) - 1U;
+}
+
+/*******************************************************************************
+* Function Name: uart_prbs_init
+********************************************************************************
+* Summary:
+* Resets the generator and the checker. Call it with no PRBS transfer active.
+*
+* Parameters:
+*  order: Sequence
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void uart_prbs_init(uart_prbs_order_t order)
+{
+    uart_prbs_setup(&uart_prbs_generator, order);
+    uart_prbs_checker = (uart_prbs_checker_t){ 0 };
+    uart_prbs_setup(&uart_prbs_checker.prbs, order);
+    uart_prbs_checker.prbs.state = 0U;
+}
+
+/*******************************************************************************
+* Function Name: uart_prbs_benchmark
+********************************************************************************
+* Summary:
+* Measures generator and checker back to back on local state. At 10 bits per
+* UART frame the result must stay below SystemCoreClock * 10 / baudrate, for
+* example 240 cycles at 6 Mbaud and 144 MHz.
+*
+* Parameters:
+*  order: Sequence
+*  bytes: Bytes to generate and check, shorter than one SysTick period on XMC1
+*
+* Return:
+*  uint32_t: CPU cycles per byte for generating and checking
+*
+*******************************************************************************/
+uint32_t uart_prbs_benchmark(uart_prbs_order_t order, uint32_t bytes)
+{
+    uart_prbs_t generator;
+    uart_prbs_checker_t checker = { 0 };
+    uint32_t start;
+    uint32_t cycles;
+
+    uart_prbs_setup(&generator, order);
+    uart_prbs_setup(&checker.prbs, order);
+    checker.prbs.state = 0U;
+
+    start = uart_cycles_now();
+    for (uint32_t i = 0U; i < bytes; i++)
+    {
+        uart_prbs_check(&checker, uart_prbs_next(&generator));
+    }
+    cycles = uart_cycles_elapsed(start);
+
+    return (bytes != 0U) ? (cycles / bytes) : 0U;
+}
+
+#endif
+
+/* [] END OF FILE */
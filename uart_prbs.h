@@ -0,0 +1,222 @@
+/******************************************************************************
+* File Name:   uart_prbs.h
+*
+* Description: This file contains the PRBS-7/15/31 generator and the
+*              self-synchronizing checker. Both work a UART byte at a time
+*              and are called from the FIFO interrupts for link tests without
+*              data buffers.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#ifndef UART_PRBS_H_
+#define UART_PRBS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "uart_config.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+/* Sequence used by the link test: 7, 15 or 31 */
+#ifndef UART_PRBS_ORDER
+#define UART_PRBS_ORDER                 UART_PRBS_15
+#endif
+
+/* Error-free bytes in a row to gain lock, errored bytes in a row to lose it */
+#define UART_PRBS_LOCK_BYTES            8U
+#define UART_PRBS_UNLOCK_BYTES          4U
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+/* ITU-T O.150 sequences: x^7+x^6+1, x^15+x^14+1, x^31+x^28+1 */
+typedef enum
+{
+    UART_PRBS_7 = 7,
+    UART_PRBS_15 = 15,
+    UART_PRBS_31 = 31
+} uart_prbs_order_t;
+
+/* Fibonacci LFSR holding the last 'order' bits, bit 0 the oldest */
+typedef struct
+{
+    uint32_t state;
+    uint32_t order;
+    uint32_t shift;             /* order - second tap */
+} uart_prbs_t;
+
+typedef struct
+{
+    uart_prbs_t prbs;           /* Loaded from the received bits */
+    bool locked;
+    uint32_t run;               /* Error-free (unlocked) or errored (locked) bytes in a row */
+    uint32_t bytes;             /* Bytes checked while locked */
+    uint32_t bit_errors;        /* Bit errors while locked, a line error counts 3 times */
+    uint32_t sync_losses;       /* Locks lost */
+} uart_prbs_checker_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Source of the TX FIFO and sink of the RX FIFO for NULL transfer buffers */
+extern uart_prbs_t uart_prbs_generator;
+extern uart_prbs_checker_t uart_prbs_checker;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void uart_prbs_init(uart_prbs_order_t order);
+uint32_t uart_prbs_benchmark(uart_prbs_order_t order, uint32_t bytes);
+
+/*******************************************************************************
+* Function Name: uart_prbs_next
+********************************************************************************
+* Summary:
+* Returns the next 8 bits of the sequence, the first bit in bit 0 as the UART
+* sends it. Up to 'second tap' bits are computed per step, one step for
+* PRBS-15 and PRBS-31, two for PRBS-7.
+*
+* Parameters:
+*  prbs: Generator
+*
+* Return:
+*  uint8_t
+*
+*******************************************************************************/
+static inline uint8_t uart_prbs_next(uart_prbs_t *prbs)
+{
+    uint32_t taps = prbs->order - prbs->shift;
+    uint32_t state = prbs->state;
+    uint32_t out = 0U;
+    uint32_t bits = 0U;
+
+    while (bits < 8U)
+    {
+        uint32_t count = ((8U - bits) < taps) ? (8U - bits) : taps;
+        uint32_t next = (state ^ (state >> prbs->shift)) & ((1UL << count) - 1U);
+
+        state = (state >> count) | (next << (prbs->order - count));
+        out |= next << bits;
+        bits += count;
+    }
+    prbs->state = state;
+
+    return (uint8_t)out;
+}
+
+/*******************************************************************************
+* Function Name: uart_prbs_check
+********************************************************************************
+* Summary:
+* Checks one received byte. Each bit is compared with the prediction from the
+* previously received bits, which then shift into the checker state, so the
+* checker needs no seed and synchronizes to any phase of the sequence. A
+* single line error is counted 3 times, once per tap it passes.
+*
+* Parameters:
+*  checker: Checker
+*  data:    Received byte
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static inline void uart_prbs_check(uart_prbs_checker_t *checker, uint8_t data)
+{
+    uint32_t order = checker->prbs.order;
+    uint32_t shift = checker->prbs.shift;
+    uint32_t taps = order - shift;
+    uint32_t state = checker->prbs.state;
+    uint32_t diff = 0U;
+    uint32_t bits = 0U;
+
+    while (bits < 8U)
+    {
+        uint32_t count = ((8U - bits) < taps) ? (8U - bits) : taps;
+        uint32_t mask = (1UL << count) - 1U;
+        uint32_t received = ((uint32_t)data >> bits) & mask;
+
+        diff |= (((state ^ (state >> shift)) & mask) ^ received) << bits;
+        state = (state >> count) | (received << (order - count));
+        bits += count;
+    }
+    checker->prbs.state = state;
+
+    if (checker->locked)
+    {
+        checker->bytes++;
+        if (diff == 0U)
+        {
+            checker->run = 0U;
+            return;
+        }
+
+        while (diff != 0U)
+        {
+            diff &= diff - 1U;
+            checker->bit_errors++;
+        }
+        if (++checker->run >= UART_PRBS_UNLOCK_BYTES)
+        {
+            checker->locked = false;
+            checker->run = 0U;
+            checker->sync_losses++;
+        }
+    }
+    else if ((diff == 0U) && (checker->prbs.state != 0U))
+    {
+        if (++checker->run >= UART_PRBS_LOCK_BYTES)
+        {
+            checker->locked = true;
+            checker->run = 0U;
+        }
+    }
+    else
+    {
+        checker->run = 0U;
+    }
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* UART_PRBS_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,222 @@
+/******************************************************************************
+* File Name:   uart_reconfig.c
+*
+* Description: This file contains the runtime reconfiguration. The channel is
+*              switched between frames: the TX FIFO is drained, the RX line is
+*              idle, and the received data stays in the RX FIFO.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#include "cybsp.h"
+#include "cycfg_peripherals.h"
+#include "uart_reconfig.h"
+#include "uart_baud.h"
+#include "uart_cycles.h"
+#include "uart_fifo.h"
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+/* Frame format range of the ASC mode. 9-bit frames are not supported, the
+ * RX path stores bytes and would truncate them.
+ */
+#define UART_RECONFIG_DATA_BITS_MIN     5U
+#define UART_RECONFIG_DATA_BITS_MAX     8U
+
+/*******************************************************************************
+* Function Name: uart_reconfig_is_idle
+********************************************************************************
+* Summary:
+* Checks for a frame boundary: no write active, TX FIFO and shift register
+* empty, and the receiver has seen an idle line.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  bool
+*
+*******************************************************************************/
+static bool uart_reconfig_is_idle(void)
+{
+    uint32_t status = XMC_UART_CH_GetStatusFlag(CYBSP_DEBUG_UART_HW);
+
+    return !uart_fifo_tx_busy() && XMC_USIC_CH_TXFIFO_IsEmpty(CYBSP_DEBUG_UART_HW) &&
+           ((status & (uint32_t)XMC_UART_CH_STATUS_FLAG_TRANSFER_STATUS_BUSY) == 0U) &&
+           ((status & (uint32_t)XMC_UART_CH_STATUS_FLAG_RECEPTION_IDLE) != 0U);
+}
+
+/*******************************************************************************
+* Function Name: uart_reconfig
+********************************************************************************
+* Summary:
+* Changes baud rate, frame format and FIFO limits of the running channel.
+* The function waits for a frame boundary in both directions and stops the
+* channel for the few register writes with interrupts disabled. Pending
+* writes are finished first; the peer must not start a frame during the
+* switch, for example by waiting for an acknowledge of the new settings.
+* Data in the RX FIFO and an active read are kept. With coalescing, the FIFO
+* limits and the fallback timer are computed again for the new frame time;
+* limits given in the settings take precedence.
+*
+* Parameters:
+*  config:  New settings
+*  timeout: Polling iterations to wait for the frame boundary
+*  result:  Achieved baud rate and switch time
+*
+* Return:
+*  uart_reconfig_status_t
+*
+*******************************************************************************/
+uart_reconfig_status_t uart_reconfig(const uart_reconfig_t *config, uint32_t timeout,
+                                     uart_reconfig_result_t *result)
+{
+    uart_baud_config_t baud_config;
+    uint32_t start;
+    uint32_t primask;
+    uint32_t poll = 0U;
+
+    result->baudrate = 0U;
+    result->drain_cycles = 0U;
+    result->switch_cycles = 0U;
+#if (UART_COALESCE_LATENCY_US != 0U)
+    result->coalesce.tx_limit = 0U;
+    result->coalesce.rx_limit = 0U;
+    result->coalesce.timer_period_us = 0U;
+#endif
+
+    if ((config->baudrate != UART_RECONFIG_KEEP) &&
+        (uart_baud_solve(XMC_SCU_CLOCK_GetPeripheralClockFrequency(), config->baudrate,
+                         &baud_config) != UART_BAUD_STATUS_OK))
+    {
+        return UART_RECONFIG_STATUS_OUT_OF_RANGE;
+    }
+    if ((config->data_bits != UART_RECONFIG_KEEP) &&
+        ((config->data_bits < UART_RECONFIG_DATA_BITS_MIN) || (config->data_bits > UART_RECONFIG_DATA_BITS_MAX)))
+    {
+        return UART_RECONFIG_STATUS_OUT_OF_RANGE;
+    }
+    if ((config->stop_bits != UART_RECONFIG_KEEP) && (config->stop_bits != 1U) && (config->stop_bits != 2U))
+    {
+        return UART_RECONFIG_STATUS_OUT_OF_RANGE;
+    }
+    /* PM = 01b is reserved */
+    if ((config->parity != UART_RECONFIG_KEEP) &&
+        (config->parity != (uint32_t)XMC_USIC_CH_PARITY_MODE_NONE) &&
+        (config->parity != (uint32_t)XMC_USIC_CH_PARITY_MODE_EVEN) &&
+        (config->parity != (uint32_t)XMC_USIC_CH_PARITY_MODE_ODD))
+    {
+        return UART_RECONFIG_STATUS_OUT_OF_RANGE;
+    }
+
+    /* Wait for a frame boundary with interrupts disabled, the FIFO
+     * interrupts finish the pending writes in between
+     */
+    start = uart_cycles_now();
+    for (;;)
+    {
+        primask = __get_PRIMASK();
+        __disable_irq();
+        if (uart_reconfig_is_idle())
+        {
+            break;
+        }
+        __set_PRIMASK(primask);
+
+        if (++poll >= timeout)
+        {
+            result->drain_cycles = uart_cycles_elapsed(start);
+            return UART_RECONFIG_STATUS_TIMEOUT;
+        }
+    }
+    result->drain_cycles = uart_cycles_elapsed(start);
+
+    start = uart_cycles_now();
+    if (XMC_UART_CH_Stop(CYBSP_DEBUG_UART_HW) != XMC_UART_CH_STATUS_OK)
+    {
+        /* Still transmitting, the channel keeps running unchanged */
+        __set_PRIMASK(primask);
+        return UART_RECONFIG_STATUS_BUSY;
+    }
+
+    if (config->baudrate != UART_RECONFIG_KEEP)
+    {
+        uart_baud_apply(CYBSP_DEBUG_UART_HW, &baud_config);
+        uart_fifo_set_baudrate(baud_config.baudrate);
+        result->baudrate = baud_config.baudrate;
+    }
+    if (config->data_bits != UART_RECONFIG_KEEP)
+    {
+        XMC_UART_CH_SetWordLength(CYBSP_DEBUG_UART_HW, (uint8_t)config->data_bits);
+        XMC_UART_CH_SetFrameLength(CYBSP_DEBUG_UART_HW, (uint8_t)config->data_bits);
+    }
+    if (config->stop_bits != UART_RECONFIG_KEEP)
+    {
+        CYBSP_DEBUG_UART_HW->PCR_ASCMode = (CYBSP_DEBUG_UART_HW->PCR_ASCMode & ~USIC_CH_PCR_ASCMode_STPB_Msk) |
+                                           ((config->stop_bits == 2U) ? USIC_CH_PCR_ASCMode_STPB_Msk : 0U);
+    }
+    if (config->parity != UART_RECONFIG_KEEP)
+    {
+        CYBSP_DEBUG_UART_HW->CCR = (CYBSP_DEBUG_UART_HW->CCR & ~USIC_CH_CCR_PM_Msk) | config->parity;
+    }
+#if (UART_COALESCE_LATENCY_US != 0U)
+    /* Same selection as at start-up, for the new frame time */
+    uart_coalesce_compute(uart_fifo_baudrate(), uart_fifo_frame_bits(), UART_COALESCE_LATENCY_US,
+                          UART_RX_FIFO_SIZE, &result->coalesce);
+    if ((result->coalesce.timer_period_us != 0U) && !uart_fifo_start_timer(result->coalesce.timer_period_us))
+    {
+        result->coalesce.rx_limit = 0U;
+    }
+    uart_fifo_set_limits(result->coalesce.tx_limit, result->coalesce.rx_limit);
+#endif
+    if ((config->tx_limit != UART_RECONFIG_KEEP) || (config->rx_limit != UART_RECONFIG_KEEP))
+    {
+        uint32_t tx_limit;
+        uint32_t rx_limit;
+
+        /* A limit not given keeps its current value */
+        uart_fifo_get_limits(&tx_limit, &rx_limit);
+        uart_fifo_set_limits((config->tx_limit != UART_RECONFIG_KEEP) ? config->tx_limit : tx_limit,
+                             (config->rx_limit != UART_RECONFIG_KEEP) ? config->rx_limit : rx_limit);
+    }
+
+    XMC_UART_CH_Start(CYBSP_DEBUG_UART_HW);
+    result->switch_cycles = uart_cycles_elapsed(start);
+
+    __set_PRIMASK(primask);
+
+    return UART_RECONFIG_STATUS_OK;
+}
+
+/* [] END OF FILE */
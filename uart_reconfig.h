@@ -0,0 +1,106 @@
+/******************************************************************************
+* File Name:   uart_reconfig.h
+*
+* Description: This file contains the interface of the runtime reconfiguration
+*              of baud rate, frame format and FIFO limits.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#ifndef UART_RECONFIG_H_
+#define UART_RECONFIG_H_
+
+#include <stdint.h>
+#include "xmc_uart.h"
+#include "uart_config.h"
+#include "uart_coalesce.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+/* Setting left unchanged */
+#define UART_RECONFIG_KEEP              0xFFFFFFFFU
+
+/* Initializer changing nothing */
+#define UART_RECONFIG_KEEP_ALL          { UART_RECONFIG_KEEP, UART_RECONFIG_KEEP, UART_RECONFIG_KEEP, \
+                                          UART_RECONFIG_KEEP, UART_RECONFIG_KEEP, UART_RECONFIG_KEEP }
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+typedef enum
+{
+    UART_RECONFIG_STATUS_OK = 0,
+    UART_RECONFIG_STATUS_TIMEOUT,       /* TX not drained or RX line not idle */
+    UART_RECONFIG_STATUS_OUT_OF_RANGE,  /* Baud rate or frame format not supported */
+    UART_RECONFIG_STATUS_BUSY           /* Channel could not be stopped, nothing changed */
+} uart_reconfig_status_t;
+
+/* New settings, UART_RECONFIG_KEEP for the ones to keep */
+typedef struct
+{
+    uint32_t baudrate;          /* Baud rate */
+    uint32_t data_bits;         /* Data bits, 5 to 8 (the RX path stores bytes) */
+    uint32_t stop_bits;         /* Stop bits, 1 or 2 */
+    uint32_t parity;            /* XMC_USIC_CH_PARITY_MODE_NONE, _EVEN or _ODD */
+    uint32_t tx_limit;          /* TX FIFO limit */
+    uint32_t rx_limit;          /* RX FIFO limit */
+} uart_reconfig_t;
+
+typedef struct
+{
+    uint32_t baudrate;          /* Achieved baud rate, 0 if unchanged */
+    uint32_t drain_cycles;      /* CPU cycles waiting for TX drained and RX idle */
+    uint32_t switch_cycles;     /* CPU cycles the channel was stopped */
+#if (UART_COALESCE_LATENCY_US != 0U)
+    uart_coalesce_config_t coalesce;    /* Limits and timer period for the new frame time */
+#endif
+} uart_reconfig_result_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+uart_reconfig_status_t uart_reconfig(const uart_reconfig_t *config, uint32_t timeout,
+                                     uart_reconfig_result_t *result);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* UART_RECONFIG_H_ */
+
+/* [] END OF FILE */
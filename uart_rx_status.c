@@ -0,0 +1,122 @@
+/******************************************************************************
+* File Name:   uart_rx_status.c
+*
+* Description: This file contains the scan of the RX error map: it skips 32 error-free
+*              bytes per word and only looks at the bits of words with an error.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#include "uart_rx_status.h"
+
+/*******************************************************************************
+* Function Name: uart_rx_status_next
+********************************************************************************
+* Summary:
+* Locates the next byte with a parity error.
+*
+* Parameters:
+*  error_map: Error map of the read
+*  length:    Number of bytes of the read
+*  from:      First byte to look at
+*
+* Return:
+*  uint32_t: Index of the byte, length if there is none
+*
+*******************************************************************************/
+uint32_t uart_rx_status_next(const uint32_t *error_map, uint32_t length, uint32_t from)
+{
+    uint32_t word_index = from / 32U;
+    uint32_t bits;
+
+    if (from >= length)
+    {
+        return length;
+    }
+
+    /* Drop the bits below the start in the first word */
+    bits = error_map[word_index] & (0xFFFFFFFFUL << (from % 32U));
+    while (bits == 0U)
+    {
+        word_index++;
+        if (word_index >= UART_RX_STATUS_WORDS(length))
+        {
+            return length;
+        }
+        bits = error_map[word_index];
+    }
+
+    from = word_index * 32U;
+    while ((bits & 1U) == 0U)
+    {
+        bits >>= 1;
+        from++;
+    }
+
+    return (from < length) ? from : length;
+}
+
+/*******************************************************************************
+* Function Name: uart_rx_status_count
+********************************************************************************
+* Summary:
+* Counts the bytes with a parity error.
+*
+* Parameters:
+*  error_map: Error map of the read
+*  length:    Number of bytes of the read
+*
+* Return:
+*  uint32_t
+*
+*******************************************************************************/
+uint32_t uart_rx_status_count(const uint32_t *error_map, uint32_t length)
+{
+    uint32_t count = 0U;
+
+    for (uint32_t i = 0U; i < UART_RX_STATUS_WORDS(length); i++)
+    {
+        uint32_t bits = error_map[i];
+
+        /* Clear the lowest set bit per step, error-free words cost one test */
+        while (bits != 0U)
+        {
+            bits &= bits - 1U;
+            count++;
+        }
+    }
+
+    return count;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,75 @@
+/******************************************************************************
+* File Name:   uart_rx_status.h
+*
+* Description: This file contains the interface of the RX status capture: a bit-packed
+*              map of the received bytes with a parity error, filled by the RX FIFO
+*              interrupt from the same OUTR read as the data.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#ifndef UART_RX_STATUS_H_
+#define UART_RX_STATUS_H_
+
+#include <stdint.h>
+#include "uart_config.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+/* In ASC mode, bit 4 of the receiver control information OUTR.RCI is the
+ * parity error flag PERR of the entry
+ */
+#define UART_RX_STATUS_PERR_POS         20U
+#define UART_RX_STATUS_PERR(outr)       (((uint32_t)(outr) >> UART_RX_STATUS_PERR_POS) & 1U)
+
+/* Words of an error map for a read of length bytes, one bit per byte */
+#define UART_RX_STATUS_WORDS(length)    (((uint32_t)(length) + 31U) / 32U)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+uint32_t uart_rx_status_next(const uint32_t *error_map, uint32_t length, uint32_t from);
+uint32_t uart_rx_status_count(const uint32_t *error_map, uint32_t length);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* UART_RX_STATUS_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,194 @@
+/******************************************************************************
+* File Name:   uart_selftest.c
+*
+* Description: This file contains the loopback self-test. The receiver is switched
+*              to the internal loopback from the transmitter, a block of data is
+*              sent through the TX and RX FIFO paths at the maximum baud rate, and
+*              the receiver is switched back to the RX pin.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#include "cybsp.h"
+#include "cycfg_peripherals.h"
+#include "uart_selftest.h"
+#include "uart_baud.h"
+#include "uart_cycles.h"
+#include "uart_fifo.h"
+#if (UART_CIPHER_ENABLE == 1)
+#include "uart_cipher.h"
+#endif
+
+#if (UART_SELFTEST_ENABLE == 1)
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+/* Margin added to the transfer time before the test times out */
+#define UART_SELFTEST_TIMEOUT_MS        10U
+
+/*******************************************************************************
+*  Global Variables
+*******************************************************************************/
+static uint8_t selftest_tx[UART_SELFTEST_LENGTH];
+static uint8_t selftest_rx[UART_SELFTEST_LENGTH];
+
+/*******************************************************************************
+* Function Name: uart_selftest_run
+********************************************************************************
+* Summary:
+* Runs the loopback self-test without external wiring. DX0 is switched to the
+* internal loopback and the baud rate to UART_SELFTEST_BAUDRATE, then
+* UART_SELFTEST_LENGTH bytes are sent and received through the FIFO driver.
+* Afterwards the RX pin and the baud rate are restored. The TX pin outputs the
+* test data. Call after uart_fifo_init() and before the completion callbacks
+* are registered, the callbacks are removed.
+*
+* Parameters:
+*  result: Achieved baud rate, errors and throughput
+*
+* Return:
+*  uart_selftest_status_t
+*
+*******************************************************************************/
+uart_selftest_status_t uart_selftest_run(uart_selftest_result_t *result)
+{
+    XMC_USIC_CH_t *const channel = CYBSP_DEBUG_UART_HW;
+    uint32_t saved_dx0cr = channel->DX0CR;
+    uint32_t saved_fdr = channel->FDR;
+    uint32_t saved_brg = channel->BRG;
+    uint32_t saved_pcr = channel->PCR_ASCMode;
+    uint32_t periph_clock = XMC_SCU_CLOCK_GetPeripheralClockFrequency();
+    uint32_t baudrate = (UART_SELFTEST_BAUDRATE != 0U) ? UART_SELFTEST_BAUDRATE :
+                                                         (periph_clock / UART_BAUD_OVERSAMPLING_MIN);
+    uart_baud_config_t baud_config;
+    uart_selftest_status_t status = UART_SELFTEST_STATUS_OK;
+    uint32_t timeout;
+    uint32_t elapsed = 0U;
+    uint32_t last;
+    uint32_t now;
+
+    result->baudrate = 0U;
+    result->bytes = 0U;
+    result->errors = 0U;
+    result->cycles = 0U;
+    result->throughput_bps = 0U;
+
+    if (uart_baud_solve(periph_clock, baudrate, &baud_config) != UART_BAUD_STATUS_OK)
+    {
+        return UART_SELFTEST_STATUS_OUT_OF_RANGE;
+    }
+
+    for (uint32_t i = 0U; i < UART_SELFTEST_LENGTH; i++)
+    {
+        selftest_tx[i] = (uint8_t)i;
+        selftest_rx[i] = (uint8_t)~i;
+    }
+
+    uart_fifo_register_callbacks(NULL, NULL);
+    XMC_UART_CH_Start(channel);
+
+    /* Receive from the own transmitter at the test baud rate */
+    XMC_USIC_CH_SetInputSource(channel, XMC_USIC_CH_INPUT_DX0, UART_SELFTEST_DX0_LOOPBACK);
+    uart_baud_apply(channel, &baud_config);
+    result->baudrate = baud_config.baudrate;
+
+    timeout = (2U * UART_SELFTEST_LENGTH * (SystemCoreClock / baud_config.baudrate) * uart_fifo_frame_bits()) +
+              ((SystemCoreClock / 1000U) * UART_SELFTEST_TIMEOUT_MS);
+
+    last = uart_cycles_now();
+    (void)uart_fifo_read(selftest_rx, UART_SELFTEST_LENGTH);
+    (void)uart_fifo_write(selftest_tx, UART_SELFTEST_LENGTH);
+
+    /* The time is accumulated while polling, so the SysTick period of XMC1
+     * does not limit the test length
+     */
+    while (uart_fifo_rx_busy())
+    {
+#if (UART_CIPHER_ENABLE == 1)
+        /* Keep the keystream ahead of the fast test baud rate */
+        uart_cipher_process();
+#endif
+        now = uart_cycles_now();
+        elapsed += uart_cycles_between(last, now);
+        last = now;
+
+        if (elapsed > timeout)
+        {
+            (void)uart_fifo_write_abort();
+            (void)uart_fifo_read_abort();
+            status = UART_SELFTEST_STATUS_TIMEOUT;
+            break;
+        }
+    }
+    elapsed += uart_cycles_elapsed(last);
+
+    result->bytes = uart_fifo_rx_count();
+    result->errors = UART_SELFTEST_LENGTH - result->bytes;
+    for (uint32_t i = 0U; i < result->bytes; i++)
+    {
+        if (selftest_rx[i] != selftest_tx[i])
+        {
+            result->errors++;
+        }
+    }
+    if ((status == UART_SELFTEST_STATUS_OK) && (result->errors != 0U))
+    {
+        status = UART_SELFTEST_STATUS_DATA_ERROR;
+    }
+
+    result->cycles = elapsed;
+    if (elapsed != 0U)
+    {
+        result->throughput_bps = (uint32_t)(((uint64_t)result->bytes * 8U * SystemCoreClock) / elapsed);
+    }
+
+    /* Back to the RX pin at the configured baud rate, an aborted frame is
+     * discarded
+     */
+    while (!XMC_USIC_CH_TXFIFO_IsEmpty(channel) ||
+           ((XMC_UART_CH_GetStatusFlag(channel) & (uint32_t)XMC_UART_CH_STATUS_FLAG_TRANSFER_STATUS_BUSY) != 0U))
+    {
+    }
+    channel->FDR = saved_fdr;
+    channel->BRG = saved_brg;
+    channel->PCR_ASCMode = saved_pcr;
+    channel->DX0CR = saved_dx0cr;
+    XMC_USIC_CH_RXFIFO_Flush(channel);
+
+    return status;
+}
+
+#endif
+
+/* [] END OF FILE */
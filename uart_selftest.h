@@ -0,0 +1,101 @@
+/******************************************************************************
+* File Name:   uart_selftest.h
+*
+* Description: This file contains the interface of the loopback self-test through
+*              the USIC internal loopback.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#ifndef UART_SELFTEST_H_
+#define UART_SELFTEST_H_
+
+#include <stdint.h>
+#include "uart_config.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+/* Bytes sent through the loopback, 256 covers every byte value */
+#ifndef UART_SELFTEST_LENGTH
+#define UART_SELFTEST_LENGTH            256U
+#endif
+
+/* Baud rate of the self-test (0 = fPERIPH / 4, the maximum) */
+#ifndef UART_SELFTEST_BAUDRATE
+#define UART_SELFTEST_BAUDRATE          0U
+#endif
+
+/* DX0 input source connected to DOUT0 of the same channel (input G). See the
+ * USIC input mapping table in the device reference manual.
+ */
+#ifndef UART_SELFTEST_DX0_LOOPBACK
+#define UART_SELFTEST_DX0_LOOPBACK      6U
+#endif
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+typedef enum
+{
+    UART_SELFTEST_STATUS_OK = 0,
+    UART_SELFTEST_STATUS_OUT_OF_RANGE,  /* Baud rate cannot be reached */
+    UART_SELFTEST_STATUS_TIMEOUT,       /* Not all bytes received */
+    UART_SELFTEST_STATUS_DATA_ERROR     /* Received bytes differ from the sent ones */
+} uart_selftest_status_t;
+
+typedef struct
+{
+    uint32_t baudrate;          /* Achieved baud rate of the test */
+    uint32_t bytes;             /* Bytes received */
+    uint32_t errors;            /* Bytes received wrong or not at all */
+    uint32_t cycles;            /* CPU cycles from the start of TX to the last byte received */
+    uint32_t throughput_bps;    /* Payload bits per second */
+} uart_selftest_result_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+uart_selftest_status_t uart_selftest_run(uart_selftest_result_t *result);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* UART_SELFTEST_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,276 @@
+/******************************************************************************
+* File Name:   uart_soak.c
+*
+* Description: This file contains the soak test. Every iteration sends a frame
+*              of pseudo-random length and payload through the FIFO driver,
+*              waits for the loopback reception, and compares it bit by bit.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#include "xmc_common.h"
+#include "cybsp.h"
+#include "xmc_uart.h"
+#include "cycfg_peripherals.h"
+#include "uart_soak.h"
+#include "uart_fifo.h"
+#include "uart_cycles.h"
+
+#if (UART_SOAK_ENABLE == 1)
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+/* Margin added to the transfer time before a frame is considered lost */
+#define UART_SOAK_TIMEOUT_MS            10U
+
+/* Body of every busy-wait loop; the host model in tools/model lets the line
+ * time pass there
+ */
+#ifndef UART_SOAK_POLL
+#define UART_SOAK_POLL()
+#endif
+
+/*******************************************************************************
+*  Global Variables
+*******************************************************************************/
+uart_soak_stats_t uart_soak_stats;
+
+static uint8_t soak_tx[UART_SOAK_MAX_LENGTH];
+static uint8_t soak_rx[UART_SOAK_MAX_LENGTH];
+static uint32_t soak_state = UART_SOAK_SEED;
+static uint32_t soak_cycles_per_byte;
+
+/*******************************************************************************
+* Function Name: uart_soak_random
+********************************************************************************
+* Summary:
+* Returns the next value of the xorshift32 sequence.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t
+*
+*******************************************************************************/
+static uint32_t uart_soak_random(void)
+{
+    soak_state ^= soak_state << 13;
+    soak_state ^= soak_state >> 17;
+    soak_state ^= soak_state << 5;
+    return soak_state;
+}
+
+/*******************************************************************************
+* Function Name: uart_soak_bit_errors
+********************************************************************************
+* Summary:
+* Counts the bits differing between the sent and the received bytes.
+*
+* Parameters:
+*  length: Bytes received
+*
+* Return:
+*  uint32_t
+*
+*******************************************************************************/
+static uint32_t uart_soak_bit_errors(uint32_t length)
+{
+    uint32_t errors = 0U;
+
+    for (uint32_t i = 0U; i < length; i++)
+    {
+        uint32_t diff = (uint32_t)(soak_tx[i] ^ soak_rx[i]);
+
+        while (diff != 0U)
+        {
+            diff &= diff - 1U;
+            errors++;
+        }
+    }
+
+    return errors;
+}
+
+/*******************************************************************************
+* Function Name: uart_soak_resync
+********************************************************************************
+* Summary:
+* Recovers from a lost frame. The bytes of the aborted frame still in the
+* TX FIFO are sent, the last one is given one frame time to arrive, and then
+* the RX FIFO is flushed. Otherwise the leftovers would shift every later
+* frame.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void uart_soak_resync(void)
+{
+    uint32_t elapsed = 0U;
+    uint32_t last = uart_cycles_now();
+    uint32_t now;
+
+    while (!XMC_USIC_CH_TXFIFO_IsEmpty(CYBSP_DEBUG_UART_HW) ||
+           ((XMC_UART_CH_GetStatusFlag(CYBSP_DEBUG_UART_HW) &
+             (uint32_t)XMC_UART_CH_STATUS_FLAG_TRANSFER_STATUS_BUSY) != 0U))
+    {
+        UART_SOAK_POLL();
+    }
+
+    /* One frame time for the last byte to be received */
+    while (elapsed < soak_cycles_per_byte)
+    {
+        UART_SOAK_POLL();
+        now = uart_cycles_now();
+        elapsed += uart_cycles_between(last, now);
+        last = now;
+    }
+
+    XMC_USIC_CH_RXFIFO_Flush(CYBSP_DEBUG_UART_HW);
+}
+
+/*******************************************************************************
+* Function Name: uart_soak_init
+********************************************************************************
+* Summary:
+* Prepares the soak test. The FIFO driver is used directly, so the completion
+* callbacks of the asynchronous API are removed. The frame timeout follows
+* the baud rate and the frame format the channel runs at.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void uart_soak_init(void)
+{
+    uart_fifo_register_callbacks(NULL, NULL);
+    soak_cycles_per_byte = (SystemCoreClock / uart_fifo_baudrate()) * uart_fifo_frame_bits();
+}
+
+/*******************************************************************************
+* Function Name: uart_soak_iteration
+********************************************************************************
+* Summary:
+* Sends one frame, waits for its reception and verifies it. The time is
+* accumulated while polling, so the SysTick period of XMC1 does not limit the
+* frame length.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  bool: true if the frame was received completely and without bit errors
+*
+*******************************************************************************/
+bool uart_soak_iteration(void)
+{
+    uint32_t length = 1U + (uart_soak_random() % UART_SOAK_MAX_LENGTH);
+    uint32_t timeout = (2U * length * soak_cycles_per_byte) + ((SystemCoreClock / 1000U) * UART_SOAK_TIMEOUT_MS);
+    uint32_t elapsed = 0U;
+    uint32_t last;
+    uint32_t now;
+    uint32_t received;
+    uint32_t errors;
+    uint64_t run_ms;
+    bool lost = false;
+
+    for (uint32_t i = 0U; i < length; i += 4U)
+    {
+        uint32_t random = uart_soak_random();
+
+        for (uint32_t j = i; (j < length) && (j < (i + 4U)); j++)
+        {
+            soak_tx[j] = (uint8_t)random;
+            random >>= 8;
+        }
+    }
+
+    last = uart_cycles_now();
+    (void)uart_fifo_read(soak_rx, length);
+    (void)uart_fifo_write(soak_tx, length);
+
+    while (uart_fifo_rx_busy())
+    {
+        UART_SOAK_POLL();
+        now = uart_cycles_now();
+        elapsed += uart_cycles_between(last, now);
+        last = now;
+
+        if (elapsed > timeout)
+        {
+            (void)uart_fifo_write_abort();
+            (void)uart_fifo_read_abort();
+            uart_soak_resync();
+            lost = true;
+            break;
+        }
+    }
+
+    received = uart_fifo_rx_count();
+    errors = uart_soak_bit_errors(received);
+    elapsed += uart_cycles_elapsed(last);
+
+    uart_soak_stats.iterations++;
+    uart_soak_stats.bytes += received;
+    uart_soak_stats.bit_errors += errors;
+    uart_soak_stats.cycles += elapsed;
+    if (lost)
+    {
+        uart_soak_stats.frames_lost++;
+    }
+    if (elapsed > uart_soak_stats.latency_max)
+    {
+        uart_soak_stats.latency_max = elapsed;
+    }
+
+    /* Milliseconds keep the products within 64 bits on multi-hour runs */
+    run_ms = uart_soak_stats.cycles / (SystemCoreClock / 1000U);
+    if (run_ms != 0U)
+    {
+        uart_soak_stats.throughput_bps = (uint32_t)((uart_soak_stats.bytes * 8000U) / run_ms);
+    }
+
+    return !lost && (errors == 0U);
+}
+
+#endif
+
+/* [] END OF FILE */
@@ -0,0 +1,96 @@
+/******************************************************************************
+* File Name:   uart_soak.h
+*
+* Description: This file contains the interface of the soak test. The soak test
+*              loops pseudo-random frames of varying length through TX, RX and
+*              verify and accumulates error, throughput and latency figures.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#ifndef UART_SOAK_H_
+#define UART_SOAK_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "uart_config.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+/* Longest frame, frame lengths are 1..UART_SOAK_MAX_LENGTH bytes */
+#ifndef UART_SOAK_MAX_LENGTH
+#define UART_SOAK_MAX_LENGTH            64U
+#endif
+
+/* Seed of the payload and length sequence, a run is reproducible */
+#ifndef UART_SOAK_SEED
+#define UART_SOAK_SEED                  0x2545F491U
+#endif
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+typedef struct
+{
+    uint32_t iterations;        /* Frames sent */
+    uint32_t frames_lost;       /* Frames not received completely within the timeout */
+    uint64_t bytes;             /* Payload bytes received */
+    uint64_t bit_errors;        /* Bits differing between sent and received bytes */
+    uint64_t cycles;            /* CPU cycles of all iterations */
+    uint32_t latency_max;       /* Longest start of TX to end of verify in CPU cycles */
+    uint32_t throughput_bps;    /* Payload bits per second over the run */
+} uart_soak_stats_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+extern uart_soak_stats_t uart_soak_stats;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void uart_soak_init(void);
+bool uart_soak_iteration(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* UART_SOAK_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,116 @@
+/******************************************************************************
+* File Name:   uart_stats.h
+*
+* Description: This file contains the driver performance counters updated by the
+*              interrupt handlers.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#ifndef UART_STATS_H_
+#define UART_STATS_H_
+
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+typedef struct
+{
+    uint32_t tx_bytes;          /* Bytes written to the TX FIFO */
+    uint32_t rx_bytes;          /* Bytes read from the RX FIFO */
+    uint32_t tx_irq_count;      /* TX FIFO limit interrupts */
+    uint32_t rx_irq_count;      /* RX FIFO limit interrupts (incl. timer drains) */
+    uint32_t timer_irq_count;   /* RX drains pended by the coalescing timer */
+    uint32_t combined_count;    /* Combined handler entries serving TX and RX */
+    uint32_t isr_cycles;        /* CPU cycles spent in the FIFO handlers */
+    uint32_t isr_cycles_max;    /* Longest single FIFO handler run */
+    uint32_t rx_fifo_full;      /* Drains that found the RX FIFO full (possible overrun) */
+    uint32_t rx_fifo_level_max; /* Highest RX FIFO level at entry of a drain */
+} uart_stats_t;
+
+/*******************************************************************************
+* Function Name: uart_stats_add_isr_cycles
+********************************************************************************
+* Summary:
+* Accounts the cycles of one interrupt handler run.
+*
+* Parameters:
+*  stats:  Counters
+*  cycles: Cycles of the handler run
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static inline void uart_stats_add_isr_cycles(uart_stats_t *stats, uint32_t cycles)
+{
+    stats->isr_cycles += cycles;
+    if (cycles > stats->isr_cycles_max)
+    {
+        stats->isr_cycles_max = cycles;
+    }
+}
+
+/*******************************************************************************
+* Function Name: uart_stats_irq_per_kbyte
+********************************************************************************
+* Summary:
+* Returns the number of TX and RX interrupts per 1000 transferred bytes.
+*
+* Parameters:
+*  stats: Counters
+*
+* Return:
+*  uint32_t: Interrupts per 1000 bytes, 0 if nothing was transferred
+*
+*******************************************************************************/
+static inline uint32_t uart_stats_irq_per_kbyte(const uart_stats_t *stats)
+{
+    uint32_t bytes = stats->tx_bytes + stats->rx_bytes;
+
+    return (bytes == 0U) ? 0U
+                         : (uint32_t)(((uint64_t)(stats->tx_irq_count + stats->rx_irq_count) * 1000U) / bytes);
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* UART_STATS_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,194 @@
+/******************************************************************************
+* File Name:   uart_stats_cmd.c
+*
+* Description: This file contains the in-band stats command. The stats command
+*              byte on the RX path is answered with a snapshot of the driver
+*              counters, queued as control frame on the TX path.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#include "uart_config.h"
+
+#if defined(COMPONENT_FREERTOS) && (UART_STATS_CMD_ENABLE == 1)
+#error "The stats reply is sent through the asynchronous API, which is not built with FreeRTOS"
+#endif
+
+#if !defined(COMPONENT_FREERTOS)
+
+#include <stdbool.h>
+#include "uart_stats_cmd.h"
+#include "uart_fifo.h"
+
+#if (UART_STATS_CMD_ENABLE == 1)
+
+/*******************************************************************************
+*  Global Variables
+*******************************************************************************/
+uint32_t uart_stats_cmd_dropped;
+
+/* Reply frame, owned by the TX queue until uart_stats_cmd_sent() */
+static uint8_t reply[UART_STATS_CMD_REPLY_SIZE];
+static volatile bool reply_busy;
+
+/*******************************************************************************
+* Function Name: uart_stats_cmd_put
+********************************************************************************
+* Summary:
+* Stores a counter little-endian into the reply.
+*
+* Parameters:
+*  offset: Position in the reply, advanced by 4
+*  value:  Counter
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void uart_stats_cmd_put(uint32_t *offset, uint32_t value)
+{
+    reply[*offset] = (uint8_t)value;
+    reply[*offset + 1U] = (uint8_t)(value >> 8);
+    reply[*offset + 2U] = (uint8_t)(value >> 16);
+    reply[*offset + 3U] = (uint8_t)(value >> 24);
+    *offset += 4U;
+}
+
+/*******************************************************************************
+* Function Name: uart_stats_cmd_sent
+********************************************************************************
+* Summary:
+* TX completion of the reply, releases the reply buffer.
+*
+* Parameters:
+*  buffer: Reply
+*  length: Reply length
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void uart_stats_cmd_sent(const uint8_t *buffer, uint32_t length)
+{
+    (void)buffer;
+    (void)length;
+
+    reply_busy = false;
+}
+
+/*******************************************************************************
+* Function Name: uart_stats_cmd_request
+********************************************************************************
+* Summary:
+* Command handler, called from the RX interrupt. Takes a snapshot of the
+* counters into the reply and queues it at control priority; a request while
+* the previous reply is still queued is counted and dropped. The reply is
+* sent as data, so the FIFO driver doubles every UART_STATS_CMD_BYTE in it
+* and it never contains an unescaped command.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void uart_stats_cmd_request(void)
+{
+    uint32_t offset = 0U;
+    uint8_t checksum = 0U;
+
+    if (reply_busy)
+    {
+        uart_stats_cmd_dropped++;
+        return;
+    }
+
+    reply[offset++] = UART_STATS_CMD_BYTE;
+    reply[offset++] = UART_STATS_CMD_VERSION;
+    reply[offset++] = (uint8_t)(4U * UART_STATS_CMD_COUNTERS);
+
+    uart_stats_cmd_put(&offset, uart_stats.tx_bytes);
+    uart_stats_cmd_put(&offset, uart_stats.rx_bytes);
+    uart_stats_cmd_put(&offset, uart_stats.tx_irq_count);
+    uart_stats_cmd_put(&offset, uart_stats.rx_irq_count);
+    uart_stats_cmd_put(&offset, uart_stats.timer_irq_count);
+    uart_stats_cmd_put(&offset, uart_stats.combined_count);
+    uart_stats_cmd_put(&offset, uart_stats.isr_cycles_max);
+    uart_stats_cmd_put(&offset, uart_stats.rx_fifo_full);
+    uart_stats_cmd_put(&offset, uart_stats.rx_fifo_level_max);
+    for (uint32_t priority = 0U; priority < UART_ASYNC_TX_PRIORITIES; priority++)
+    {
+        uart_stats_cmd_put(&offset, uart_async_tx_queue_max[priority]);
+        uart_stats_cmd_put(&offset, uart_async_tx_wait_max[priority]);
+    }
+
+    /* Two's complement checksum, the sum over the whole reply is zero */
+    for (uint32_t i = 0U; i < offset; i++)
+    {
+        checksum += reply[i];
+    }
+    reply[offset++] = (uint8_t)(0U - checksum);
+
+    reply_busy = true;
+    if (uart_tx_async_priority(reply, offset, UART_ASYNC_PRIORITY_CONTROL,
+                               uart_stats_cmd_sent) != UART_ASYNC_SUCCESS)
+    {
+        reply_busy = false;
+        uart_stats_cmd_dropped++;
+    }
+}
+
+/*******************************************************************************
+* Function Name: uart_stats_cmd_init
+********************************************************************************
+* Summary:
+* Enables the stats command. Call it after uart_async_init().
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void uart_stats_cmd_init(void)
+{
+    uart_fifo_register_command(uart_stats_cmd_request);
+}
+
+#endif
+
+#endif
+
+/* [] END OF FILE */
@@ -0,0 +1,79 @@
+/******************************************************************************
+* File Name:   uart_stats_cmd.h
+*
+* Description: This file contains the interface of the in-band stats command.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#ifndef UART_STATS_CMD_H_
+#define UART_STATS_CMD_H_
+
+#include <stdint.h>
+#include "uart_config.h"
+#include "uart_async.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+/* Reply layout version */
+#define UART_STATS_CMD_VERSION          1U
+
+/* Counters in the reply, 32-bit little-endian each */
+#define UART_STATS_CMD_COUNTERS         (9U + (2U * UART_ASYNC_TX_PRIORITIES))
+
+/* Reply: UART_STATS_CMD_BYTE, version, payload length, counters, checksum */
+#define UART_STATS_CMD_REPLY_SIZE       (3U + (4U * UART_STATS_CMD_COUNTERS) + 1U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Requests received while the previous reply was still being sent */
+extern uint32_t uart_stats_cmd_dropped;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void uart_stats_cmd_init(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* UART_STATS_CMD_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,113 @@
+/******************************************************************************
+* File Name:   uart_timestamp.c
+*
+* Description: This file contains the free-running timestamp timer. XMC4 uses the
+*              DWT cycle counter, XMC1 a 16-bit CCU4 slice clocked by PCLK / 64.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#include "uart_timestamp.h"
+#include "uart_cycles.h"
+#include "xmc_scu.h"
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+#if (UC_FAMILY == XMC1)
+/* CCU4 prescaler, PCLK / 64 gives 1 MHz (XMC11/12/13) or 1.5 MHz (XMC14) */
+#define UART_TIMESTAMP_PRESCALER        XMC_CCU4_SLICE_PRESCALER_64
+#define UART_TIMESTAMP_PRESCALER_DIV    64U
+#endif
+
+/*******************************************************************************
+* Function Name: uart_timestamp_init
+********************************************************************************
+* Summary:
+* Starts the timestamp timer.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void uart_timestamp_init(void)
+{
+#if (UC_FAMILY == XMC1)
+    const XMC_CCU4_SLICE_COMPARE_CONFIG_t timer_config =
+    {
+        .timer_mode = XMC_CCU4_SLICE_TIMER_COUNT_MODE_EA,
+        .monoshot = false,
+        .prescaler_mode = XMC_CCU4_SLICE_PRESCALER_MODE_NORMAL,
+        .prescaler_initval = UART_TIMESTAMP_PRESCALER,
+        .passive_level = XMC_CCU4_SLICE_OUTPUT_PASSIVE_LEVEL_LOW,
+        .timer_concatenation = false
+    };
+
+    XMC_CCU4_Init(UART_TIMESTAMP_CCU4_MODULE, XMC_CCU4_SLICE_MCMS_ACTION_TRANSFER_PR_CR);
+    XMC_CCU4_StartPrescaler(UART_TIMESTAMP_CCU4_MODULE);
+    XMC_CCU4_SLICE_CompareInit(UART_TIMESTAMP_CCU4_SLICE, &timer_config);
+    XMC_CCU4_SLICE_SetTimerPeriodMatch(UART_TIMESTAMP_CCU4_SLICE, (uint16_t)UART_TIMESTAMP_MASK);
+    XMC_CCU4_EnableShadowTransfer(UART_TIMESTAMP_CCU4_MODULE, UART_TIMESTAMP_CCU4_SHADOW);
+    XMC_CCU4_EnableClock(UART_TIMESTAMP_CCU4_MODULE, UART_TIMESTAMP_CCU4_SLICE_NUM);
+    XMC_CCU4_SLICE_StartTimer(UART_TIMESTAMP_CCU4_SLICE);
+#else
+    uart_cycles_init();
+#endif
+}
+
+/*******************************************************************************
+* Function Name: uart_timestamp_frequency
+********************************************************************************
+* Summary:
+* Returns the timestamp tick frequency.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: Ticks per second
+*
+*******************************************************************************/
+uint32_t uart_timestamp_frequency(void)
+{
+#if (UC_FAMILY == XMC1)
+    return XMC_SCU_CLOCK_GetFastPeripheralClockFrequency() / UART_TIMESTAMP_PRESCALER_DIV;
+#else
+    return SystemCoreClock;
+#endif
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,109 @@
+/******************************************************************************
+* File Name:   uart_timestamp.h
+*
+* Description: This file contains the interface of the free-running timestamp
+*              timer used for the RX timestamps.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#ifndef UART_TIMESTAMP_H_
+#define UART_TIMESTAMP_H_
+
+#include <stdint.h>
+#include "xmc_common.h"
+
+#if (UC_FAMILY == XMC1)
+#include "xmc_ccu4.h"
+#endif
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+#if (UC_FAMILY == XMC1)
+/* CCU4 slice used as timestamp timer on XMC1 (no DWT cycle counter) */
+#ifndef UART_TIMESTAMP_CCU4_MODULE
+#define UART_TIMESTAMP_CCU4_MODULE      CCU40
+#define UART_TIMESTAMP_CCU4_SLICE       CCU40_CC43
+#define UART_TIMESTAMP_CCU4_SLICE_NUM   3U
+#define UART_TIMESTAMP_CCU4_SHADOW      XMC_CCU4_SHADOW_TRANSFER_SLICE_3
+#endif
+
+/* Timestamp counter width in bits, timestamps wrap at 2^UART_TIMESTAMP_BITS */
+#define UART_TIMESTAMP_BITS             16U
+#else
+#define UART_TIMESTAMP_BITS             32U
+#endif
+
+#define UART_TIMESTAMP_MASK             ((uint32_t)((1ULL << UART_TIMESTAMP_BITS) - 1U))
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void uart_timestamp_init(void);
+uint32_t uart_timestamp_frequency(void);
+
+/*******************************************************************************
+* Function Name: uart_timestamp_now
+********************************************************************************
+* Summary:
+* Returns the current timestamp: the DWT cycle counter on XMC4, the CCU4
+* timer on XMC1.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: Timestamp in ticks of uart_timestamp_frequency()
+*
+*******************************************************************************/
+static inline uint32_t uart_timestamp_now(void)
+{
+#if (UC_FAMILY == XMC1)
+    return XMC_CCU4_SLICE_GetTimerValue(UART_TIMESTAMP_CCU4_SLICE);
+#else
+    return DWT->CYCCNT;
+#endif
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* UART_TIMESTAMP_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,155 @@
+/******************************************************************************
+* File Name:   uart_trace.c
+*
+* Description: This file contains the trace buffer of the binary event trace.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#include "uart_trace.h"
+
+#if (UART_TRACE_ENABLE == 1)
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+/* Events logged per benchmark measurement, at most the minimal depth */
+#define UART_TRACE_BENCHMARK_EVENTS     8U
+
+#if ((UART_TRACE_DEPTH & (UART_TRACE_DEPTH - 1U)) != 0U)
+#error "UART_TRACE_DEPTH must be a power of two"
+#endif
+
+/*******************************************************************************
+*  Global Variables
+*******************************************************************************/
+/* Trace buffer, dump sizeof(uart_trace_buffer) bytes at its address */
+uart_trace_buffer_t uart_trace_buffer;
+
+/*******************************************************************************
+* Function Name: uart_trace_init
+********************************************************************************
+* Summary:
+* Clears the trace buffer and records the timestamp clock. Call it after the
+* cycle counter has been started and after SysTick has been configured, the
+* XMC1 timestamps are taken from the SysTick down counter.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void uart_trace_init(void)
+{
+    uart_trace_buffer.magic = UART_TRACE_MAGIC;
+    uart_trace_buffer.version = UART_TRACE_VERSION;
+    uart_trace_buffer.depth = UART_TRACE_DEPTH;
+    uart_trace_buffer.clock_hz = SystemCoreClock;
+#if (UC_FAMILY == XMC4)
+    uart_trace_buffer.counter_period = 0U;
+#else
+    uart_trace_buffer.counter_period = SysTick->LOAD + 1U;
+#endif
+    uart_trace_buffer.head = 0U;
+}
+
+/*******************************************************************************
+* Function Name: uart_trace_update_clock
+********************************************************************************
+* Summary:
+* Records the timestamp clock again after SysTick has been reprogrammed, for
+* example by vTaskStartScheduler() on XMC1. A changed counter period is
+* logged as UART_TRACE_CLOCK with the previous period, so the decoder times
+* the older records with it.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void uart_trace_update_clock(void)
+{
+#if (UC_FAMILY == XMC4)
+    uint32_t period = 0U;
+#else
+    uint32_t period = SysTick->LOAD + 1U;
+#endif
+    uint32_t previous = uart_trace_buffer.counter_period;
+
+    uart_trace_buffer.clock_hz = SystemCoreClock;
+    if (period != previous)
+    {
+        uart_trace_buffer.counter_period = period;
+        UART_TRACE(UART_TRACE_CLOCK, previous - 1U);
+    }
+}
+
+/*******************************************************************************
+* Function Name: uart_trace_benchmark
+********************************************************************************
+* Summary:
+* Measures UART_TRACE() by logging a few events, then removes them again.
+* Call at start-up after uart_fifo_init(), while the buffer has not wrapped.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: CPU cycles per event, including the loop
+*
+*******************************************************************************/
+uint32_t uart_trace_benchmark(void)
+{
+    uint32_t head = uart_trace_buffer.head;
+    uint32_t start;
+    uint32_t cycles;
+
+    start = uart_cycles_now();
+    for (uint32_t i = 0U; i < UART_TRACE_BENCHMARK_EVENTS; i++)
+    {
+        UART_TRACE(UART_TRACE_USER, i);
+    }
+    cycles = uart_cycles_elapsed(start);
+
+    uart_trace_buffer.head = head;
+
+    return cycles / UART_TRACE_BENCHMARK_EVENTS;
+}
+
+#endif
+
+/* [] END OF FILE */
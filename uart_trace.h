@@ -0,0 +1,156 @@
+/******************************************************************************
+* File Name:   uart_trace.h
+*
+* Description: This file contains the binary event trace. The FIFO interrupts
+*              and the application log events with a timestamp into a RAM ring
+*              that is read out with the debugger and decoded on the host by
+*              tools/uart_trace_decode.c.
+*
+* Related Document: See README.md
+*
+******************************************************************************
+*
+* Copyright (c) 2015-2021, Infineon Technologies AG
+* All rights reserved.                        
+*                                             
+* Boost Software License - Version 1.0 - August 17th, 2003
+* 
+* Permission is hereby granted, free of charge, to any person or organization
+* obtaining a copy of the software and accompanying documentation covered by
+* this license (the "Software") to use, reproduce, display, distribute,
+* execute, and transmit the Software, and to prepare derivative works of the
+* Software, and to permit third-parties to whom the Software is furnished to
+* do so, all subject to the following:
+* 
+* The copyright notices in the Software and this entire statement, including
+* the above license grant, this restriction and the following disclaimer,
+* must be included in all copies of the Software, in whole or in part, and
+* all derivative works of the Software, unless such copies or derivative
+* works are solely in the form of machine-executable object code generated by
+* a source language processor.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+* SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+* FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*                                                                              
+*****************************************************************************/
+
+#ifndef UART_TRACE_H_
+#define UART_TRACE_H_
+
+#include <stdint.h>
+#include "uart_config.h"
+
+#if !defined(UART_TRACE_HOST_BUILD)
+#include "xmc_common.h"
+#include "uart_cycles.h"
+#endif
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+/* Trace buffer identification ("UTRC") and layout version */
+#define UART_TRACE_MAGIC                0x43525455U
+#define UART_TRACE_VERSION              2U
+
+/* Events, the argument is stored in the upper 24 bits of the event word */
+#define UART_TRACE_ISR_BEGIN            0x01U   /* arg: service request (0, 1) */
+#define UART_TRACE_ISR_END              0x02U   /* arg: service request (0, 1) */
+#define UART_TRACE_TX_REFILL            0x03U   /* arg: bytes written to the TX FIFO */
+#define UART_TRACE_RX_DRAIN             0x04U   /* arg: bytes read from the RX FIFO */
+#define UART_TRACE_RX_LIMIT             0x05U   /* arg: new RX FIFO limit */
+#define UART_TRACE_TX_DONE              0x06U   /* arg: write length */
+#define UART_TRACE_RX_DONE              0x07U   /* arg: read length */
+#define UART_TRACE_VERIFY               0x08U   /* arg: mismatching bytes (0 = pass) */
+#define UART_TRACE_CLOCK                0x09U   /* arg: previous counter period - 1 */
+#define UART_TRACE_USER                 0x80U   /* First application defined event */
+
+#define UART_TRACE_EVENT_Msk            0xFFU
+#define UART_TRACE_ARG_Pos              8U
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+typedef struct
+{
+    uint32_t timestamp;         /* uart_cycles_now() */
+    uint32_t event;             /* Event in bits 0..7, argument in bits 8..31 */
+} uart_trace_record_t;
+
+/* Self-describing trace buffer, dumped as a whole by the debugger */
+typedef struct
+{
+    uint32_t magic;             /* UART_TRACE_MAGIC */
+    uint16_t version;           /* UART_TRACE_VERSION */
+    uint16_t depth;             /* Number of records, a power of two */
+    uint32_t clock_hz;          /* Timestamp frequency */
+    uint32_t counter_period;    /* 0: 32-bit up counter, else current down counter period */
+    volatile uint32_t head;     /* Number of events logged, oldest records are overwritten */
+    uart_trace_record_t records[UART_TRACE_DEPTH];
+} uart_trace_buffer_t;
+
+#if !defined(UART_TRACE_HOST_BUILD)
+#if (UART_TRACE_ENABLE == 1)
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+extern uart_trace_buffer_t uart_trace_buffer;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void uart_trace_init(void);
+void uart_trace_update_clock(void);
+uint32_t uart_trace_benchmark(void);
+
+/*******************************************************************************
+* Function Name: uart_trace_log
+********************************************************************************
+* Summary:
+* Logs one event. The record slot is claimed with interrupts disabled so the
+* interrupts and the main loop can log concurrently. uart_trace_benchmark()
+* measures the cycles per call.
+*
+* Parameters:
+*  event: Event (UART_TRACE_xxx)
+*  arg:   24-bit event argument
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static inline void uart_trace_log(uint32_t event, uint32_t arg)
+{
+    uint32_t primask = __get_PRIMASK();
+    uart_trace_record_t *record;
+
+    __disable_irq();
+    record = &uart_trace_buffer.records[uart_trace_buffer.head & (UART_TRACE_DEPTH - 1U)];
+    uart_trace_buffer.head++;
+    record->timestamp = uart_cycles_now();
+    record->event = event | (arg << UART_TRACE_ARG_Pos);
+    __set_PRIMASK(primask);
+}
+
+#define UART_TRACE(event, arg)          uart_trace_log((event), (arg))
+#else
+/* The argument is not evaluated, sizeof only keeps its variables in use */
+#define UART_TRACE(event, arg)          ((void)sizeof(arg))
+#endif
+#endif
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* UART_TRACE_H_ */
+
+/* [] END OF FILE */